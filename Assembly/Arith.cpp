@@ -0,0 +1,666 @@
+// Arith.cpp — driver tunggal untuk semua backend aritmatika (lihat Arith.hpp)
+// Di tiap host: backend asm arsitektur itu + backend portable, dalam 1 binary.
+// Arsitektur lain bisa di-cross-compile lalu dijalankan dengan QEMU user-mode:
+//   aarch64-linux-gnu-g++ -std=c++20 -O2 Arith.cpp -o arith-a64 -lfmt
+//   qemu-aarch64 -L /usr/aarch64-linux-gnu ./arith-a64 -bench
+//   riscv64-linux-gnu-g++ -std=c++20 -O2 Arith.cpp -o arith-rv64 -lfmt
+//   qemu-riscv64 -L /usr/riscv64-linux-gnu ./arith-rv64 -bench
+// (angka benchmark di bawah QEMU mengukur emulator, hanya untuk cek kebenaran)
+
+/* Detect compiler */
+#if defined(__clang__)
+	#define COMPILER "LLVM Clang"
+#elif defined(_MSC_VER)
+	#define COMPILER "MSVC"
+#elif defined(__GNUC__)
+	#define COMPILER "GNU"
+#endif
+
+/* Detect OS + arch */
+#if defined(_WIN64)
+	#define SYSTEM "Windows x64"
+#elif defined(_WIN32)
+	#define SYSTEM "Windows x86"
+#elif defined(__linux__)
+	#define SYSTEM "Linux"
+#elif defined(__APPLE__)
+	#define SYSTEM "MacOS"
+#endif
+
+/* Detect CPU arch */
+#if defined(__aarch64__)
+    #define CPU "AArch64"
+#elif defined (__arm__) || defined(_M_ARM)
+    #define CPU "ARM-32"
+#elif defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+    #define CPU "x86-64"
+#elif defined(__i386__) || defined(_M_IX86)
+    #define CPU "x86"
+#elif defined(__riscv)
+    #define CPU "RISC-V"
+#elif defined(__powerpc64__)
+    #define CPU "POWER-PC-64"
+#endif
+
+#include <fmt/format.h>
+#include <argparse/argparse.hpp>
+#include "Arith.hpp"
+#include "Batch.hpp"
+#include "Bench.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// -batch: kolom (x, y) dari file lewat 1 backend, hasil ke file; ringkasan ke stderr
+template <typename T>
+int RunBatch(const Batch::Options& o) {
+    Batch::Stats st = Batch::Run<T>(o);
+    double elems = double(st.Rows) * o.Ops.size();
+    fmt::print(stderr, "{} rows x {} ops, backend {} ({}), {} blocks of {}\n",
+               st.Rows, o.Ops.size(), o.Backend, Bench::TypeName<T>(), st.Blocks, o.Block);
+    fmt::print(stderr, "total {:.3f} s ({:.2f} Mrow/s), kernel {:.3f} s ({:.3f} ns/op), parse+IO {:.3f} s\n",
+               st.TotalNs / 1e9, st.Rows / (st.TotalNs / 1e3), st.ComputeNs / 1e9,
+               elems ? st.ComputeNs / elems : 0.0, (st.TotalNs - st.ComputeNs) / 1e9);
+    return 0;
+}
+
+// Referensi pembagi invariant: Mod::div (int / int64, INT_MIN / -1 = INT_MIN seperti InvDiv), / untuk unsigned
+template <typename T>
+T RefDiv(T a, T b) {
+    if constexpr (std::is_signed_v<T>) {
+        if (a == std::numeric_limits<T>::min() && b == -1)
+            return a;
+        return Mod::div(a, b);
+    } else {
+        return a / b;
+    }
+}
+
+// o = x / d lewat kernel packed terlebar (x86) atau InvDiv scalar
+template <typename T>
+void InvDivArray(const std::vector<T>& x, const InvDiv::Divider<T>& d, std::vector<T>& o) {
+#if defined(ARITH_X86)
+    VAsm::div<T>(x, d, o);
+#else
+    InvDiv::div(x.data(), d, o.data(), std::min(x.size(), o.size()));
+#endif
+}
+
+// Mismatch Divider scalar + kernel array terhadap RefDiv untuk 1 pembagi
+template <typename T>
+size_t CheckInvDiv(T d, const std::vector<T>& x, std::vector<T>& o) {
+    InvDiv::Divider<T> dv(d);
+    InvDivArray(x, dv, o);
+    size_t bad = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+        T ref = RefDiv(x[i], d);
+        bad += dv(x[i]) != ref;
+        bad += o[i] != ref;
+    }
+    return bad;
+}
+
+// Pembagi uji: -1024..1024, ±2^k dan ±(2^k ± 1), batas tipe, plus extra (dari -xi / -yi)
+template <typename T>
+std::vector<T> InvDivDivisors(std::initializer_list<T> extra) {
+    std::vector<T> ds(extra);
+    for (int d = -1024; d <= 1024; d++)
+        ds.push_back(T(d));
+    for (int k = 0; k < int(sizeof(T) * 8); k++) {
+        T p = T(T(1) << k);
+        for (T d : {p, T(p - 1), T(p + 1)})
+            ds.insert(ds.end(), {d, T(T(0) - d)});
+    }
+    ds.insert(ds.end(), {std::numeric_limits<T>::max(), std::numeric_limits<T>::min()});
+    std::erase(ds, T(0));
+    return ds;
+}
+
+// Dividend uji: batas tipe + len nilai tersebar (Weyl step, semua bit ikut berubah)
+template <typename T>
+std::vector<T> InvDivDividends(size_t len, T seed) {
+    using U = std::make_unsigned_t<T>;
+    constexpr T lo = std::numeric_limits<T>::min(), hi = std::numeric_limits<T>::max();
+    std::vector<T> x = {0, 1, T(-1), 2, T(-2), lo, T(lo + 1), hi, T(hi - 1), seed, T(0) - seed};
+    U v = U(seed);
+    for (size_t i = 0; i < len; i++)
+        x.push_back(T(v += U(0x9E3779B97F4A7C15ull)));
+    return x;
+}
+
+template <typename T>
+void ReportInvDiv(size_t len, T seed, std::initializer_list<T> extra) {
+    std::vector<T> ds = InvDivDivisors<T>(extra), x = InvDivDividends<T>(len, seed), o(x.size());
+    size_t bad = 0;
+    for (T d : ds)
+        bad += CheckInvDiv(d, x, o);
+    fmt::println(" {:<6} {} pembagi x {} dividend: {}", Bench::TypeName<T>(), ds.size(), x.size(),
+                 bad ? fmt::format("{} mismatch", bad) : "OK");
+}
+
+// Semua 2^32 dividend 32-bit untuk 1 pembagi, per blok 64K (scalar + kernel array)
+template <typename T>
+void ExhaustiveInvDiv(T d) {
+    std::vector<T> x(1 << 16), o(x.size());
+    size_t bad = 0;
+    double t0 = Bench::NowNs();
+    for (uint64_t base = 0; base < (uint64_t(1) << 32); base += x.size()) {
+        for (size_t j = 0; j < x.size(); j++)
+            x[j] = T(uint32_t(base + j));
+        bad += CheckInvDiv(d, x, o);
+    }
+    fmt::println(" {:<6} d = {:<11} 2^32 dividend: {}  ({:.1f} s)", Bench::TypeName<T>(), d,
+                 bad ? fmt::format("{} mismatch", bad) : "OK", (Bench::NowNs() - t0) / 1e9);
+}
+
+int main(const int argc, const char** argv) {
+    argparse::ArgumentParser Args("main");
+
+    Args.add_argument("-xi")
+        .default_value(3)
+        .scan<'i', int>()
+        .help("input int value 1");
+        
+    Args.add_argument("-yi")
+        .default_value(3)
+        .scan<'i', int>()
+        .help("input int value 2");
+
+    Args.add_argument("-xf")
+        .default_value(3.14f)
+        .scan<'g', float>()
+        .help("input float value 1");
+        
+    Args.add_argument("-yf")
+        .default_value(2.71f)
+        .scan<'g', float>()
+        .help("input float value 2");
+
+    Args.add_argument("-len")
+        .default_value(1003)
+        .scan<'i', int>()
+        .help("panjang array untuk kernel packed (bukan kelipatan 16 supaya tail ikut teruji)");
+
+    Args.add_argument("-bench")
+        .default_value(false)
+        .implicit_value(true)
+        .help("benchmark semua backend (throughput + latency), output CSV");
+
+    Args.add_argument("-iters")
+        .default_value(1 << 20)
+        .scan<'i', int>()
+        .help("benchmark: op per repetisi");
+
+    Args.add_argument("-reps")
+        .default_value(11)
+        .scan<'i', int>()
+        .help("benchmark: jumlah repetisi (median / min / stddev)");
+
+    Args.add_argument("-warmup")
+        .default_value(2)
+        .scan<'i', int>()
+        .help("benchmark: repetisi awal yang dibuang");
+
+    Args.add_argument("-exhaustive")
+        .default_value(false)
+        .implicit_value(true)
+        .help("pembagi invariant: cek semua 2^32 dividend int / uint untuk beberapa pembagi (lambat)");
+
+    Args.add_argument("-csv")
+        .help("benchmark: file output CSV (default stdout)");
+
+    Args.add_argument("-batch")
+        .help("batch: file input pasangan (x, y), CSV atau binary interleaved");
+
+    Args.add_argument("-out")
+        .default_value(std::string("-"))
+        .help("batch: file output (default stdout, CSV)");
+
+    Args.add_argument("-ops")
+        .default_value(std::string("add,sub,mul,div"))
+        .help("batch: daftar op, dipisah koma");
+
+    Args.add_argument("-backend")
+        .default_value(std::string("Mod"))
+        .help("batch: backend (Asm, LAsm, HAsm, OldC, CtC, Mod, ModF, Cx, SwarC, VAsm, VAsm:AVX, VAsm:AVX~rcp1, ...)");
+
+    Args.add_argument("-type")
+        .default_value(std::string("int"))
+        .help("batch: tipe operand, int / int64 / float / double");
+
+    Args.add_argument("-format")
+        .default_value(std::string("auto"))
+        .help("batch: format input / output, auto (dari ekstensi .csv), csv, bin");
+
+    Args.add_argument("-block")
+        .default_value(4096)
+        .scan<'i', int>()
+        .help("batch: row per blok (x, y, hasil per op dipakai ulang di cache)");
+
+    Args.parse_args(argc, argv);
+
+    if (auto in = Args.present<std::string>("-batch")) {
+        try {
+            Batch::Options o;
+            o.Input = *in;
+            o.Output = Args.get<std::string>("-out");
+            o.Backend = Args.get<std::string>("-backend");
+            o.Ops = Batch::ParseOps(Args.get<std::string>("-ops"));
+            o.Block = std::max(Args.get<int>("-block"), 1);
+
+            std::string format = Args.get<std::string>("-format");
+            o.InFormat = Batch::ParseFormat(format, o.Input);
+            o.OutFormat = o.Output == "-" ? Batch::Format::CSV : Batch::ParseFormat(format, o.Output);
+
+            std::string type = Args.get<std::string>("-type");
+            if (type == "int")
+                return RunBatch<int>(o);
+            if (type == "float")
+                return RunBatch<float>(o);
+            if (type == "int64")
+                return RunBatch<int64_t>(o);
+            if (type == "double")
+                return RunBatch<double>(o);
+            fmt::println(stderr, "Error: Unknown type '{}' (int, int64, float, double)", type);
+        } catch (const std::exception& e) {
+            fmt::println(stderr, "Error: {}", e.what());
+        }
+        return 1;
+    }
+
+    fmt::println("Compiled using {} on {} with {} CPU", COMPILER, SYSTEM, CPU);
+
+    int xi = Args.get<int>("-xi");
+    int yi = Args.get<int>("-yi");
+    float xf = Args.get<float>("-xf");
+    float yf = Args.get<float>("-yf");
+
+    fmt::println("\nInputed: xi = {}, yi = {}", xi, yi);
+    fmt::println("Inputed: xf = {}, yf = {}\n", xf, yf);
+
+    // Semua backend yang ter-compile untuk arsitektur ini, int pakai xi/yi, float pakai xf/yf
+    Arith::ForEach(Arith::All{}, [&](auto b) {
+        using B = decltype(b);
+        using T = typename B::Type;
+        constexpr bool isFloat = std::is_floating_point_v<T>;
+        T x = isFloat ? T(xf) : T(xi), y = isFloat ? T(yf) : T(yi);
+
+        fmt::println("{:-^50}", fmt::format("{} {}", B::Name, Bench::TypeName<T>()));
+        if (!B::Available()) {
+            fmt::println(" (tidak didukung CPU ini)\n");
+            return;
+        }
+        fmt::println(" + (Add): {}", B::add(x, y));
+        fmt::println(" - (sub): {}", B::sub(x, y));
+        fmt::println(" * (mul): {}", B::mul(x, y));
+        fmt::println(" / (div): {}\n", B::div(x, y));
+    });
+
+    // Soft-arithmetic: CtC (scalar) dan SwarC (per lane) dicek terhadap C biasa,
+    // termasuk operand negatif dan batas int (add/sub/mul wrap mod 2^32)
+    size_t len = std::max(Args.get<int>("-len"), 1);
+    std::vector<int> xv, yv;
+    for (int a : {xi, -xi, yi, 0, 1, -1, 7, -7, 12345, -999999, INT32_MAX, INT32_MIN}) {
+        for (int b : {yi, -yi, xi, 1, -1, 3, -3, 100, -65536, INT32_MAX, INT32_MIN + 1}) {
+            if (b != 0) {
+                xv.push_back(a);
+                yv.push_back(b);
+            }
+        }
+    }
+    std::vector<int> ov(xv.size());
+
+    auto wrap = [](auto op) { return [op](int a, int b) { return (int)op((uint32_t)a, (uint32_t)b); }; };
+    auto cdiv = [](int a, int b) { return a == INT32_MIN && b == -1 ? INT32_MIN : a / b; };
+    using IntOp = int (*)(int, int);
+    using IntArr = void (*)(const int*, const int*, int*, size_t);
+    std::tuple<IntOp, IntArr, std::function<int(int, int)>> softOps[] = {
+        {CtC::add, SwarC::add, wrap(std::plus<>{})},
+        {CtC::sub, SwarC::sub, wrap(std::minus<>{})},
+        {CtC::mul, SwarC::mul, wrap(std::multiplies<>{})},
+        {CtC::div, SwarC::div, cdiv},
+    };
+
+    size_t badCtC = 0, badSwar = 0;
+    for (auto& [scalar, lanes, ref] : softOps) {
+        lanes(xv.data(), yv.data(), ov.data(), xv.size());
+        for (size_t i = 0; i < xv.size(); i++) {
+            badCtC += scalar(xv[i], yv[i]) != ref(xv[i], yv[i]);
+            badSwar += ov[i] != ref(xv[i], yv[i]);
+        }
+    }
+    fmt::println("{:-^50}", "Constant-time soft arithmetic");
+    fmt::println(" {} pasang operand, SwarC {} lane", xv.size(), SwarC::Lanes);
+    fmt::println(" CtC      add/sub/mul/div: {}", badCtC ? fmt::format("{} mismatch", badCtC) : "OK");
+    fmt::println(" SwarC    add/sub/mul/div: {}\n", badSwar ? fmt::format("{} mismatch", badSwar) : "OK");
+
+    // Tabel di-generate compiler (static_assert untuk backend C sudah lolos saat compile);
+    // di sini backend asm dicek terhadap hasil compile time yang sama
+    fmt::println("{:-^50}", "Compile-time table");
+    fmt::println(" {} case int, {} int64, {} float, {} double", Arith::Table::Ints.size(), Arith::Table::Int64s.size(),
+                 Arith::Table::Floats.size(), Arith::Table::Doubles.size());
+    Arith::ForEach(Arith::All{}, [&](auto b) {
+        using B = decltype(b);
+        if (!B::Available())
+            return;
+        size_t bad = Arith::Table::Check<B>();
+        fmt::println(" {:<5} {:<6} add/sub/mul/div: {}", B::Name, Bench::TypeName<typename B::Type>(),
+                     bad ? fmt::format("{} mismatch", bad) : "OK");
+    });
+    fmt::println("");
+
+    // Pembagi invariant (magic + shift) terhadap Mod::div / unsigned /, scalar dan kernel array
+    fmt::println("{:-^50}", "Invariant divisor (InvDiv)");
+#if defined(ARITH_X86)
+    fmt::println(" Kernel: {}", VAsm::BestDiv<int>() ? "AVX2" : "scalar");
+#endif
+    int dy = yi ? yi : 7;
+    ReportInvDiv<int32_t>(len, xi, {xi, yi});
+    ReportInvDiv<uint32_t>(len, xi, {uint32_t(xi), uint32_t(yi)});
+    ReportInvDiv<int64_t>(len, xi, {xi, yi, int64_t(xi) << 32 | uint32_t(yi)});
+    ReportInvDiv<uint64_t>(len, xi, {uint64_t(xi), uint64_t(yi), uint64_t(xi) << 32 | uint32_t(yi)});
+    if (Args.get<bool>("-exhaustive")) {
+        for (int32_t d : {1, -1, 2, 3, -7, 10, 36, 641, 1000000007, INT32_MAX, INT32_MIN, dy})
+            ExhaustiveInvDiv(d);
+        for (uint32_t d : {1u, 3u, 7u, 36u, 641u, 0x80000001u, UINT32_MAX, uint32_t(dy)})
+            ExhaustiveInvDiv(d);
+    }
+    fmt::println("");
+
+#if defined(ARITH_X86)
+    // Array: x[i] = xf + (i % 1024) / 4, y[i] = yf (tetap di range half), dicek per elemen
+    std::vector<float> xs(len), ys(len, yf), out(len);
+    for (size_t i = 0; i < len; i++)
+        xs[i] = xf + (i % 1024) * 0.25f;
+
+    using Op = float (*)(float, float);
+    using OpD = double (*)(double, double);
+
+    fmt::println("{:-^50}", "x86 packed ASM float (array)");
+    fmt::println(" Best: {} ({} elements)", VAsm::Best().Name, len);
+    for (const auto& k : VAsm::Available()) {
+        size_t bad = 0;
+        std::pair<VAsm::Fn, Op> ops[] = {{k.add, ModF::add}, {k.sub, ModF::sub}, {k.mul, ModF::mul}, {k.div, ModF::div}};
+        for (auto [f, ref] : ops) {
+            f(xs.data(), ys.data(), out.data(), len);
+            for (size_t i = 0; i < len; i++)
+                bad += out[i] != ref(xs[i], ys[i]);
+        }
+        fmt::println(" {:<8} add/sub/mul/div: {}", k.Name, bad ? fmt::format("{} mismatch", bad) : "OK");
+    }
+    VAsm::add(xs, ys, out);
+    fmt::println(" + (Add): {} {} {} ... {}\n", out[0], out[1], out[2], out[len - 1]);
+
+    // Input double = input float yang sama, jadi error relatif per lebar bisa dibandingkan
+    std::vector<double> xd(xs.begin(), xs.end()), yd(ys.begin(), ys.end()), outd(len);
+
+    fmt::println("{:-^50}", "x86 packed ASM double (array)");
+    for (const auto& k : VAsm::Available<double>()) {
+        size_t bad = 0;
+        std::pair<VAsm::FnD, OpD> ops[] = {{k.add, ModF::add}, {k.sub, ModF::sub}, {k.mul, ModF::mul}, {k.div, ModF::div}};
+        for (auto [f, ref] : ops) {
+            f(xd.data(), yd.data(), outd.data(), len);
+            for (size_t i = 0; i < len; i++)
+                bad += outd[i] != ref(xd[i], yd[i]);
+        }
+        fmt::println(" {:<8} add/sub/mul/div: {}", k.Name, bad ? fmt::format("{} mismatch", bad) : "OK");
+    }
+    fmt::println("");
+
+    // half / bfloat16: packed harus sama persis dengan konversi scalar (RNE),
+    // lalu error relatif maksimum per lebar terhadap double (dari input float asli)
+    std::vector<uint16_t> xh(len), yh(len), oh(len), xb(len), yb(len), ob(len);
+    for (size_t i = 0; i < len; i++) {
+        xh[i] = Half::FromFloat(xs[i]);
+        yh[i] = Half::FromFloat(ys[i]);
+        xb[i] = BFloat::FromFloat(xs[i]);
+        yb[i] = BFloat::FromFloat(ys[i]);
+    }
+
+    auto relErr = [](double got, double exact) { return exact != 0 ? std::abs(got - exact) / std::abs(exact) : std::abs(got); };
+    std::pair<Op, OpD> refs[] = {{ModF::add, ModF::add}, {ModF::sub, ModF::sub}, {ModF::mul, ModF::mul}, {ModF::div, ModF::div}};
+
+    double floatErr = 0;
+    for (auto [f, d] : refs) {
+        for (size_t i = 0; i < len; i++)
+            floatErr = std::max(floatErr, relErr(f(xs[i], ys[i]), d(xd[i], yd[i])));
+    }
+
+    fmt::println("{:-^50}", "x86 packed half / bfloat16 (array)");
+    fmt::println(" {:<8} {:>2} byte  max rel err {:.3e}", "double", 8, 0.0);
+    fmt::println(" {:<8} {:>2} byte  max rel err {:.3e}", "float", 4, floatErr);
+    for (const auto& k : VAsm::Available16()) {
+        bool half = k.Name == std::string("F16C");
+        const auto& xq = half ? xh : xb;
+        const auto& yq = half ? yh : yb;
+        auto& oq = half ? oh : ob;
+        auto toF = half ? Half::ToFloat : BFloat::ToFloat;
+        auto fromF = half ? Half::FromFloat : BFloat::FromFloat;
+
+        size_t bad = 0, j = 0;
+        double err = 0;
+        for (VAsm::Fn16 f : {k.add, k.sub, k.mul, k.div}) {
+            auto [ref, exact] = refs[j++];
+            f(xq.data(), yq.data(), oq.data(), len);
+            for (size_t i = 0; i < len; i++) {
+                bad += oq[i] != fromF(ref(toF(xq[i]), toF(yq[i])));
+                err = std::max(err, relErr(toF(oq[i]), exact(xd[i], yd[i])));
+            }
+        }
+        fmt::println(" {:<8} {:>2} byte  max rel err {:.3e}  add/sub/mul/div: {}", k.Name, 2, err,
+                     bad ? fmt::format("{} mismatch", bad) : "OK");
+
+        // Hasil add 16-bit, dikonversi balik ke float untuk ditampilkan
+        k.add(xq.data(), yq.data(), oq.data(), len);
+        fmt::println(" {:<8} + (Add): {} {} {} ... {}", "", toF(oq[0]), toF(oq[1]), toF(oq[2]), toF(oq[len - 1]));
+    }
+    fmt::println("");
+
+    // Div approx: error dalam ULP terhadap ModF::div (div IEEE, correctly rounded).
+    // Pembagi bervariasi (0.5 .. 10.5) supaya mantissa rcp tidak sama semua
+    std::vector<float> yr(len);
+    for (size_t i = 0; i < len; i++)
+        yr[i] = 0.5f + (i * 7919 % 1000) * 0.01f;
+    auto ulp = [](float a, float b) {
+        auto ord = [](float f) { int32_t v = std::bit_cast<int32_t>(f); return v < 0 ? int64_t(INT32_MIN) - v : int64_t(v); };
+        return std::abs(ord(a) - ord(b));
+    };
+
+    fmt::println("{:-^50}", "x86 approx div (rcp + Newton-Raphson)");
+    for (const auto& k : VAsm::AvailableApprox()) {
+        for (int steps = 0; steps < 3; steps++) {
+            k.rdiv[steps](xs.data(), yr.data(), out.data(), len);
+            int64_t maxUlp = 0;
+            double meanUlp = 0;
+            for (size_t i = 0; i < len; i++) {
+                int64_t d = ulp(out[i], ModF::div(xs[i], yr[i]));
+                maxUlp = std::max(maxUlp, d);
+                meanUlp += double(d) / len;
+            }
+            fmt::println(" {:<8} NR {}  max {:>5} ulp  mean {:.3f} ulp", k.Name, steps, maxUlp, meanUlp);
+        }
+    }
+    fmt::println("");
+
+    // FMA: fma / axpy harus sama persis dengan std::fma (1 pembulatan); dot dan Horner
+    // (deret Taylor exp, derajat 7) dicek terhadap evaluasi double
+    std::vector<float> cs(len), ts(len), acc(len);
+    for (size_t i = 0; i < len; i++) {
+        cs[i] = 1.0f / (i + 1);
+        ts[i] = (i % 1024) / 1024.0f - 0.5f;
+    }
+    const std::vector<float> poly = {1.0f, 1.0f, 1 / 2.0f, 1 / 6.0f, 1 / 24.0f, 1 / 120.0f, 1 / 720.0f, 1 / 5040.0f};
+
+    fmt::println("{:-^50}", "x86 FMA (HAsm)");
+    if (Cpu::HasFMA()) {
+        size_t bad = 0;
+        HAsm::fma(xs.data(), ys.data(), cs.data(), out.data(), len);
+        acc = cs;
+        HAsm::axpy(yf, xs.data(), acc.data(), len);
+        for (size_t i = 0; i < len; i++) {
+            float exact = std::fma(xs[i], ys[i], cs[i]);
+            bad += HAsm::fma(xs[i], ys[i], cs[i]) != exact;
+            bad += out[i] != exact;
+            bad += acc[i] != std::fma(yf, xs[i], cs[i]);
+        }
+        fmt::println(" fma scalar / packed, axpy: {}", bad ? fmt::format("{} mismatch", bad) : "OK");
+
+        double dotExact = 0;
+        for (size_t i = 0; i < len; i++)
+            dotExact += double(xs[i]) * ys[i];
+        float dot = HAsm::dot(xs.data(), ys.data(), len);
+        fmt::println(" dot      {} elemen: {}  rel err {:.3e}", len, dot, relErr(dot, dotExact));
+
+        HAsm::horner(poly, ts.data(), out.data(), len);
+        size_t badH = 0;
+        double errH = 0;
+        for (size_t i = 0; i < len; i++) {
+            double exact = 0;
+            for (size_t j = poly.size(); j-- > 0;)
+                exact = exact * ts[i] + poly[j];
+            badH += out[i] != HAsm::horner(poly, ts[i]);
+            errH = std::max(errH, relErr(out[i], exact));
+        }
+        fmt::println(" horner   derajat {}, packed vs scalar: {}  max rel err {:.3e}\n", poly.size() - 1,
+                     badH ? fmt::format("{} mismatch", badH) : "OK", errH);
+    } else {
+        fmt::println(" (tidak didukung CPU ini)\n");
+    }
+#endif
+
+    if (!Args.get<bool>("-bench"))
+        return 0;
+
+    // Benchmark: semua backend skalar yang tersedia, lalu (x86) packed per elemen
+    Bench::Config cfg;
+    cfg.Iters = std::max(Args.get<int>("-iters"), 1);
+    cfg.Reps = std::max(Args.get<int>("-reps"), 1);
+    cfg.Warmup = std::max(Args.get<int>("-warmup"), 0);
+
+    std::vector<Bench::Row> rows;
+    Arith::ForEach(Arith::All{}, [&](auto b) {
+        using B = decltype(b);
+        using T = typename B::Type;
+        if (!B::Available())
+            return;
+        if constexpr (std::is_floating_point_v<T>)
+            BENCH_NAMESPACE(rows, B::Name, B, T, xf, yf, cfg);
+        else
+            BENCH_NAMESPACE(rows, B::Name, B, T, xi, yi, cfg);
+    });
+
+    // SwarC per elemen (yi = 0 diganti 1 supaya div terdefinisi)
+    std::vector<int> xa(len), ya(len, yi ? yi : 1), oa(len);
+    for (size_t i = 0; i < len; i++)
+        xa[i] = xi + (int)i;
+    std::pair<const char*, IntArr> swarOps[] = {{"add", SwarC::add}, {"sub", SwarC::sub}, {"mul", SwarC::mul}, {"div", SwarC::div}};
+    for (auto [op, f] : swarOps)
+        Bench::Array(rows, "SwarC", op, [&, f] { f(xa.data(), ya.data(), oa.data(), len); }, len, cfg, "int");
+
+    // Pembagi invariant per elemen, d = dy tetap: / C dengan d runtime (idiv / div), Asm idiv,
+    // InvDiv scalar, dan kernel packed. Dividend sama dengan cek di atas
+    auto benchInvDiv = [&](auto tag) {
+        using T = decltype(tag);
+        const char* type = Bench::TypeName<T>();
+        std::vector<T> xq = InvDivDividends<T>(len, xi), oq(xq.size());
+        T d = T(dy);
+        Bench::DoNotOptimize(d); // supaya compiler tidak mengganti / dengan multiply-shift
+        InvDiv::Divider<T> dv(d);
+        size_t n = xq.size();
+
+        Bench::Array(rows, "Mod", "div/d", [&] {
+            for (size_t i = 0; i < n; i++)
+                oq[i] = RefDiv(xq[i], d);
+        }, n, cfg, type);
+#if defined(ARITH_X86)
+    #if defined(ARITH_ASM_INT64)
+        constexpr bool asmDiv = std::is_signed_v<T>;
+    #else
+        constexpr bool asmDiv = std::is_same_v<T, int>;
+    #endif
+        if constexpr (asmDiv) {
+            Bench::Array(rows, "Asm", "div/d", [&] {
+                for (size_t i = 0; i < n; i++)
+                    oq[i] = xq[i] == std::numeric_limits<T>::min() && d == -1 ? xq[i] : Asm::div(xq[i], d);
+            }, n, cfg, type);
+        }
+#endif
+        Bench::Array(rows, "InvDiv", "div/d", [&] { InvDiv::div(xq.data(), dv, oq.data(), n); }, n, cfg, type);
+#if defined(ARITH_X86)
+        if (VAsm::DivFn<T> f = VAsm::BestDiv<T>())
+            Bench::Array(rows, "VAsm:AVX2", "div/d", [&, f] { f(xq.data(), dv, oq.data(), n); }, n, cfg, type);
+#endif
+    };
+    benchInvDiv(int32_t{});
+    benchInvDiv(uint32_t{});
+    benchInvDiv(int64_t{});
+    benchInvDiv(uint64_t{});
+
+#if defined(ARITH_X86)
+    // Packed per elemen: float / double / half / bfloat16 (pakai -len besar untuk lihat bandwidth)
+    for (const auto& k : VAsm::Available()) {
+        std::string name = std::string("VAsm:") + k.Name;
+        for (auto [op, f] : {std::pair{"add", k.add}, {"sub", k.sub}, {"mul", k.mul}, {"div", k.div}})
+            Bench::Array(rows, name, op, [&, f] { f(xs.data(), ys.data(), out.data(), len); }, len, cfg);
+    }
+    for (const auto& k : VAsm::Available<double>()) {
+        std::string name = std::string("VAsm:") + k.Name;
+        for (auto [op, f] : {std::pair{"add", k.add}, {"sub", k.sub}, {"mul", k.mul}, {"div", k.div}})
+            Bench::Array(rows, name, op, [&, f] { f(xd.data(), yd.data(), outd.data(), len); }, len, cfg, "double");
+    }
+    for (const auto& k : VAsm::Available16()) {
+        bool half = k.Name == std::string("F16C");
+        uint16_t *xq = half ? xh.data() : xb.data(), *yq = half ? yh.data() : yb.data(), *oq = half ? oh.data() : ob.data();
+        std::string name = std::string("VAsm:") + k.Name;
+        for (auto [op, f] : {std::pair{"add", k.add}, {"sub", k.sub}, {"mul", k.mul}, {"div", k.div}})
+            Bench::Array(rows, name, op, [=] { f(xq, yq, oq, len); }, len, cfg, half ? "half" : "bf16");
+    }
+
+    for (const auto& k : VAsm::AvailableApprox()) {
+        std::string name = std::string("VAsm:") + k.Name;
+        for (int steps = 0; steps < 3; steps++) {
+            VAsm::Fn f = k.rdiv[steps];
+            Bench::Array(rows, name, fmt::format("rdiv{}", steps), [&, f] { f(xs.data(), yr.data(), out.data(), len); }, len, cfg);
+        }
+    }
+
+    // FMA: fused vs mul lalu add terpisah (scalar: latency rantai, array: per elemen)
+    if (Cpu::HasFMA()) {
+        Bench::Op<float>(rows, "HAsm", "fma", [](float a, float b) { return HAsm::fma(a, b, 0.5f); }, xf, yf, 1.0f, cfg);
+        Bench::Op<float>(rows, "HAsm", "mul+add", [](float a, float b) { return HAsm::add(HAsm::mul(a, b), 0.5f); }, xf, yf, 1.0f, cfg);
+
+        const auto& best = VAsm::Best();
+        Bench::Array(rows, std::string("VAsm:") + best.Name, "mul+add", [&] {
+            best.mul(xs.data(), ys.data(), out.data(), len);
+            best.add(out.data(), cs.data(), out.data(), len);
+        }, len, cfg);
+        Bench::Array(rows, "HAsm", "fma", [&] { HAsm::fma(xs.data(), ys.data(), cs.data(), out.data(), len); }, len, cfg);
+        Bench::Array(rows, "HAsm", "axpy", [&] { HAsm::axpy(0.5f, cs.data(), acc.data(), len); }, len, cfg);
+        Bench::Array(rows, "HAsm", "dot", [&] {
+            float s = HAsm::dot(xs.data(), ys.data(), len);
+            Bench::DoNotOptimize(s);
+        }, len, cfg);
+        Bench::Array(rows, "HAsm", "horner7", [&] { HAsm::horner(poly, ts.data(), out.data(), len); }, len, cfg);
+    }
+#endif
+
+    std::FILE* csv = stdout;
+    if (auto path = Args.present<std::string>("-csv")) {
+        csv = std::fopen(path->c_str(), "w");
+        if (!csv) {
+            fmt::println("Error: cannot open '{}'", *path);
+            return 1;
+        }
+    }
+    Bench::PrintCSV(csv, rows);
+    if (csv != stdout)
+        std::fclose(csv);
+    return 0;
+}
@@ -0,0 +1,673 @@
+// Arith.hpp — backend aritmatika (add/sub/mul/div) sebagai library (header-only)
+// Backend portable (OldC, CtC, Mod, ModF, Cx) selalu ada; backend asm dipilih saat compile
+// sesuai arsitektur target (Arith_x86.hpp / Arith_ARM.hpp / Arith_RISCV.hpp).
+// Tiap backend dibungkus struct tag, jadi pemanggilan lewat tipe tetap di-inline:
+//   Arith::ForEach(Arith::All{}, [](auto b) {
+//       using B = decltype(b);
+//       if (B::Available()) fmt::println("{}: {}", B::Name, B::add(1, 2));
+//   });
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <utility>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// OLD C — BITWISE IMPLEMENTATION
+namespace OldC {
+    // BITWISE ADD
+    constexpr int add(int a, int b) {
+        while(b != 0) {
+            int carry = a & b;    // bit yang sama (1+1)
+            a = a ^ b;            // penjumlahan tanpa carry
+            b = carry << 1;       // carry geser kiri
+        }
+        return a;
+    }
+
+    // BITWISE SUB (A - B)
+    constexpr int sub(int a, int b) {
+        while(b != 0) {
+            int borrow = (~a) & b;
+            a = a ^ b;
+            b = borrow << 1;
+        }
+        return a;
+    }
+
+    // BITWISE MUL
+    constexpr int mul(int a, int b) {
+        int result = 0;
+        while(b > 0) {
+            if(b & 1) result = add(result, a);
+            a <<= 1;
+            b >>= 1;
+        }
+        return result;
+    }
+
+    // BITWISE DIV (integer, a >= 0, b > 0)
+    constexpr int div(int a, int b) {
+        int result = 0;
+        int bit = 1 << 30; // start dari bit tertinggi
+
+        while(bit > 0) {
+            // int64: b * (result + bit) bisa lewat INT_MAX (UB, dan error di constexpr)
+            if(((int64_t)b * (result + bit)) <= a) {
+                result |= bit;
+            }
+            bit >>= 1;
+        }
+        return result;
+    }
+
+} // namespace OldC
+
+// CONSTANT-TIME C — bitwise tanpa branch, jumlah iterasi tetap (tidak tergantung data)
+// OldC: add/sub loop sampai carry 0, mul salah untuk b < 0, div pakai * dan overflow.
+// Di sini semua op hanya &, |, ^, ~, shift; template V = uint32_t (1 lane)
+// atau vector GCC (SwarC, banyak lane sekaligus) dengan kode yang sama
+namespace CtC {
+    namespace Detail {
+        // Bit 0 disalin ke semua bit: 0 → 0, 1 → 0xFFFFFFFF (mask tanpa branch / negasi)
+        template <typename V>
+        constexpr V Smear(V x) {
+            x &= 1;
+            x |= x << 1;
+            x |= x << 2;
+            x |= x << 4;
+            x |= x << 8;
+            x |= x << 16;
+            return x;
+        }
+
+        // a + b + cin dengan carry lookahead Kogge-Stone: 5 langkah tetap untuk 32 bit.
+        // g = generate, p = propagate; setelah prefix, g[i] = carry keluar dari bit i
+        template <typename V>
+        constexpr V AddC(V a, V b, V cin, V* cout = nullptr) {
+            V p = a ^ b, g = (a & b) | (p & cin);
+            V pp = p;
+            for (int s = 1; s < 32; s <<= 1) {
+                g |= pp & (g << s);
+                pp &= pp << s;
+            }
+            if (cout)
+                *cout = g >> 31;
+            return p ^ ((g << 1) | cin);
+        }
+
+        template <typename V>
+        constexpr V Add(V a, V b) {
+            return AddC(a, b, V{} | 0u);
+        }
+
+        // a - b = a + ~b + 1
+        template <typename V>
+        constexpr V Sub(V a, V b) {
+            return AddC(a, ~b, V{} | 1u);
+        }
+
+        // Shift-add 32 langkah; perkalian mod 2^32 sama untuk signed / unsigned.
+        // Partial product dijumlah carry-save (s, c) tanpa propagasi carry,
+        // jadi hanya 1 AddC di akhir, bukan 32
+        template <typename V>
+        constexpr V Mul(V a, V b) {
+            V s = V{} | 0u, c = V{} | 0u;
+            for (int i = 0; i < 32; i++) {
+                V pp = a & Smear(b);
+                V t = s ^ c ^ pp;
+                c = ((s & c) | (s & pp) | (c & pp)) << 1;
+                s = t;
+                a <<= 1;
+                b >>= 1;
+            }
+            return Add(s, c);
+        }
+
+        // |x| dan mask tanda (0 / semua 1) dari x sebagai int32
+        template <typename V>
+        constexpr V Abs(V x, V& sign) {
+            sign = Smear(x >> 31);
+            return AddC(x ^ sign, V{} | 0u, sign & 1);
+        }
+
+        // Signed restoring division (shift-subtract), 32 langkah tetap.
+        // Pembulatan ke 0 seperti C; b == 0 → semua bit quotient 1 (tidak trap)
+        template <typename V>
+        constexpr V Div(V a, V b) {
+            V sa, sb;
+            V na = Abs(a, sa), nb = Abs(b, sb);
+            V nbInv = ~nb;
+
+            // r < nb ≤ 2^31, jadi (r << 1) | bit tetap muat 32 bit
+            V q = V{} | 0u, r = V{} | 0u;
+            for (int i = 31; i >= 0; i--) {
+                r = (r << 1) | ((na >> i) & 1);
+                V ge;                                  // carry keluar r + ~nb + 1 = (r >= nb)
+                V diff = AddC(r, nbInv, V{} | 1u, &ge);
+                V m = Smear(ge);
+                r = (diff & m) | (r & ~m);
+                q |= ge << i;
+            }
+
+            V sq = sa ^ sb;
+            return AddC(q ^ sq, V{} | 0u, sq & 1);
+        }
+    }
+
+    constexpr int add(int a, int b) {
+        return (int)Detail::Add<uint32_t>(a, b);
+    }
+
+    constexpr int sub(int a, int b) {
+        return (int)Detail::Sub<uint32_t>(a, b);
+    }
+
+    constexpr int mul(int a, int b) {
+        return (int)Detail::Mul<uint32_t>(a, b);
+    }
+
+    constexpr int div(int a, int b) {
+        return (int)Detail::Div<uint32_t>(a, b);
+    }
+}
+
+// SWAR / SIMD — CtC di vector GCC 4 × uint32 (128-bit: baseline SSE2 / NEON, tanpa ganti ABI),
+// compiler menurunkan ke instruksi vector target. o[i] = x[i] op y[i]; sisa n % Lanes pakai CtC scalar
+namespace SwarC {
+    using V = uint32_t __attribute__((vector_size(16)));
+    constexpr size_t Lanes = sizeof(V) / sizeof(uint32_t);
+
+    #define SWAR_OP(NAME, DETAIL)                                           \
+        inline void NAME(const int* x, const int* y, int* o, size_t n) {    \
+            size_t i = 0;                                                   \
+            for (; i + Lanes <= n; i += Lanes) {                            \
+                V a, b;                                                     \
+                std::memcpy(&a, x + i, sizeof a);                           \
+                std::memcpy(&b, y + i, sizeof b);                           \
+                V r = CtC::Detail::DETAIL(a, b);                            \
+                std::memcpy(o + i, &r, sizeof r);                           \
+            }                                                               \
+            for (; i < n; i++)                                              \
+                o[i] = CtC::NAME(x[i], y[i]);                               \
+        }
+
+    SWAR_OP(add, Add)
+    SWAR_OP(sub, Sub)
+    SWAR_OP(mul, Mul)
+    SWAR_OP(div, Div)
+
+    #undef SWAR_OP
+}
+
+// Modern C
+namespace Mod {
+    constexpr int add(int a, int b) { 
+        return a + b;
+    };
+    
+    constexpr int sub(int a, int b) { 
+        return a - b;
+    };
+    
+    constexpr int mul(int a, int b) { 
+        return a * b;
+    };
+
+    constexpr int div(int a, int b) { 
+        return a / b;
+    };
+
+    // 64-bit
+    constexpr int64_t add(int64_t a, int64_t b) {
+        return a + b;
+    }
+
+    constexpr int64_t sub(int64_t a, int64_t b) {
+        return a - b;
+    }
+
+    constexpr int64_t mul(int64_t a, int64_t b) {
+        return a * b;
+    }
+
+    constexpr int64_t div(int64_t a, int64_t b) {
+        return a / b;
+    }
+}
+
+// Modern C
+namespace ModF {
+    constexpr float add(float a, float b) { 
+        return a + b;
+    };
+    
+    constexpr float sub(float a, float b) { 
+        return a - b;
+    };
+    
+    constexpr float mul(float a, float b) { 
+        return a * b;
+    };
+
+    constexpr float div(float a, float b) { 
+        return a / b;
+    };
+
+    // double
+    constexpr double add(double a, double b) {
+        return a + b;
+    }
+
+    constexpr double sub(double a, double b) {
+        return a - b;
+    }
+
+    constexpr double mul(double a, double b) {
+        return a * b;
+    }
+
+    constexpr double div(double a, double b) {
+        return a / b;
+    }
+}
+
+// HALF (IEEE binary16) / BFLOAT16 — format storage 16-bit, hitung tetap di float.
+// Konversi scalar round-to-nearest-even, hasilnya sama persis dengan F16C vcvtps2ph $0
+// dan kernel BF16 di VAsm (dipakai untuk tail dan sebagai referensi)
+namespace Half {
+    constexpr uint16_t FromFloat(float f) {
+        uint32_t u = std::bit_cast<uint32_t>(f);
+        uint32_t sign = u >> 16 & 0x8000, abs = u & 0x7FFFFFFF;
+
+        if (abs > 0x7F800000)                      // NaN: payload atas + quiet bit
+            return sign | 0x7E00 | (abs >> 13 & 0x3FF);
+        if (abs >= 0x477FF000)                     // ≥ 65520 → inf
+            return sign | 0x7C00;
+        if (abs < 0x38800000) {                    // < 2^-14 → subnormal half (m × 2^-24)
+            uint32_t e = abs >> 23, m = (abs & 0x7FFFFF) | 0x800000;
+            uint32_t shift = 126 - e;
+            if (shift > 24)
+                return sign;
+            uint32_t r = m >> shift, rem = m & ((1u << shift) - 1), half = 1u << (shift - 1);
+            r += rem > half || (rem == half && (r & 1));
+            return sign | r;
+        }
+
+        // Normal: bias 127 → 15, buang 13 bit mantissa dengan RNE (carry boleh naik ke exponent)
+        uint32_t r = abs - 0x38000000;
+        r += 0xFFF + (r >> 13 & 1);
+        return sign | r >> 13;
+    }
+
+    constexpr float ToFloat(uint16_t h) {
+        uint32_t sign = uint32_t(h & 0x8000) << 16, e = h >> 10 & 0x1F, m = h & 0x3FF;
+        if (e == 0x1F)
+            return std::bit_cast<float>(sign | 0x7F800000 | m << 13);
+        if (e == 0) {
+            float f = m * 0x1p-24f;
+            return sign ? -f : f;
+        }
+        return std::bit_cast<float>(sign | (e + 112) << 23 | m << 13);
+    }
+}
+
+// bfloat16 = 16 bit atas float (exponent sama, mantissa 7 bit)
+namespace BFloat {
+    constexpr uint16_t FromFloat(float f) {
+        uint32_t u = std::bit_cast<uint32_t>(f);
+        if ((u & 0x7FFFFFFF) > 0x7F800000)
+            return u >> 16 | 0x40;
+        return (u + 0x7FFF + (u >> 16 & 1)) >> 16;
+    }
+
+    constexpr float ToFloat(uint16_t b) {
+        return std::bit_cast<float>(uint32_t(b) << 16);
+    }
+}
+
+// PEMBAGI INVARIANT (gaya libdivide): n / d untuk d yang sama di banyak n, tanpa idiv.
+// Magic m dan shift dihitung sekali per d, tiap pembagian = 1 mulhi + add / shift
+// (Granlund & Montgomery 1994, fig. 4.1 unsigned, fig. 5.1 signed). Hasil sama persis dengan
+// / C (pembulatan ke 0); INT_MIN / -1 wrap ke INT_MIN (idiv trap, / C UB)
+namespace InvDiv {
+    namespace Detail {
+        // N bit atas dari a * b
+        constexpr uint32_t MulHi(uint32_t a, uint32_t b) {
+            return uint64_t(a) * b >> 32;
+        }
+
+        // 4 hasil 32 × 32 (sama dengan kernel AVX2), __int128 kalau ada
+        constexpr uint64_t MulHi(uint64_t a, uint64_t b) {
+        #if defined(__SIZEOF_INT128__)
+            return uint64_t((unsigned __int128)a * b >> 64);
+        #else
+            uint64_t aL = uint32_t(a), aH = a >> 32, bL = uint32_t(b), bH = b >> 32;
+            uint64_t t = aH * bL + (aL * bL >> 32);
+            uint64_t w = uint32_t(t) + aL * bH;
+            return aH * bH + (t >> 32) + (w >> 32);
+        #endif
+        }
+
+        constexpr int32_t MulHi(int32_t a, int32_t b) {
+            return int32_t(int64_t(a) * b >> 32);
+        }
+
+        // Tanpa __int128: dari unsigned, koreksi -b kalau a < 0 dan -a kalau b < 0 (mod 2^64)
+        constexpr int64_t MulHi(int64_t a, int64_t b) {
+        #if defined(__SIZEOF_INT128__)
+            return int64_t((__int128)a * b >> 64);
+        #else
+            uint64_t ua = a, ub = b;
+            return int64_t(MulHi(ua, ub) - (a < 0 ? ub : 0) - (b < 0 ? ua : 0));
+        #endif
+        }
+
+        // (hi * 2^N + lo) / d, syarat hi < d (hasil muat N bit). Restoring shift-subtract,
+        // hanya saat membuat Divider jadi tidak butuh div 128-bit
+        template <typename U>
+        constexpr U DivWide(U hi, U lo, U d) {
+            constexpr int N = sizeof(U) * 8;
+            U q = 0;
+            for (int i = N - 1; i >= 0; i--) {
+                bool carry = hi >> (N - 1);
+                hi = U(hi << 1) | (lo >> i & 1);
+                q = U(q << 1);
+                if (carry || hi >= d) {
+                    hi -= d;
+                    q |= 1;
+                }
+            }
+            return q;
+        }
+
+        // ceil(log2 x), x >= 1
+        template <typename U>
+        constexpr int Log2Up(U x) {
+            return x == 1 ? 0 : int(sizeof(U) * 8) - std::countl_zero(U(x - 1));
+        }
+    }
+
+    // T = int32_t / uint32_t / int64_t / uint64_t. Throw std::domain_error kalau d == 0
+    template <typename T>
+    struct Divider {
+        static_assert(std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+        using U = std::make_unsigned_t<T>;
+        static constexpr int N = sizeof(T) * 8;
+
+        // Unsigned: Magic = N bit bawah multiplier N+1 bit, q = (t + ((n - t) >> Shift1)) >> Shift2.
+        // Signed: Magic = m - 2^N (sebagai U), Shift2 = l - 1, Sign = 0 / semua 1 (d < 0)
+        U Magic = 0;
+        uint8_t Shift1 = 0, Shift2 = 0;
+        U Sign = 0;
+
+        constexpr explicit Divider(T d) {
+            if (d == 0)
+                throw std::domain_error("InvDiv: division by zero");
+            if constexpr (std::is_unsigned_v<T>) {
+                int l = Detail::Log2Up<U>(d);
+                U pow = l < N ? U(U(1) << l) : U(0); // 2^l mod 2^N
+                Magic = Detail::DivWide<U>(U(pow - d), 0, d) + 1;
+                Shift1 = std::min(l, 1);
+                Shift2 = std::max(l - 1, 0);
+            } else {
+                U ad = d < 0 ? U(0) - U(d) : U(d);
+                int l = std::max(Detail::Log2Up(ad), 1);
+                // m = 1 + 2^(N+l-1) / |d|; |d| = 1 → m = 2^N + 1 (hasil bagi tidak muat N bit)
+                Magic = ad == 1 ? U(1) : U(Detail::DivWide<U>(U(U(1) << (l - 1)), 0, ad) + 1);
+                Shift2 = l - 1;
+                Sign = d < 0 ? U(-1) : U(0);
+            }
+        }
+
+        constexpr T operator()(T n) const {
+            U un = U(n);
+            if constexpr (std::is_unsigned_v<T>) {
+                U t = Detail::MulHi(Magic, un);
+                return (t + U(U(un - t) >> Shift1)) >> Shift2;
+            } else {
+                U q0 = un + U(Detail::MulHi(T(Magic), n));
+                U q = U(T(q0) >> Shift2) - U(n >> (N - 1));
+                return T((q ^ Sign) - Sign);
+            }
+        }
+    };
+
+    // o[i] = x[i] / d (scalar, referensi dan fallback untuk kernel packed)
+    template <typename T>
+    inline void div(const T* x, const Divider<T>& d, T* o, size_t n) {
+        for (size_t i = 0; i < n; i++)
+            o[i] = d(x[i]);
+    }
+}
+
+namespace Arith {
+    template <typename... B>
+    struct List {};
+
+    template <typename... A, typename... B>
+    List<A..., B...> Concat(List<A...>, List<B...>);
+
+    // f(B{}) untuk tiap backend di list, urut sesuai deklarasi
+    template <typename... B, typename F>
+    void ForEach(List<B...>, F&& f) {
+        (f(B{}), ...);
+    }
+
+    // Tag backend: Type = tipe operand, Name = label output / CSV,
+    // Available() = dicek saat runtime (mis. HAsm butuh AVX).
+    // SPEC = constexpr untuk backend C murni; asm volatile tidak bisa constexpr
+    #define ARITH_BACKEND_AS(SPEC, TAG, NAME, NS, T, AVAILABLE)             \
+        struct TAG {                                                        \
+            using Type = T;                                                 \
+            static constexpr const char* Name = NAME;                       \
+            static bool Available() { return AVAILABLE; }                   \
+            static SPEC T add(T a, T b) { return NS::add(a, b); }           \
+            static SPEC T sub(T a, T b) { return NS::sub(a, b); }           \
+            static SPEC T mul(T a, T b) { return NS::mul(a, b); }           \
+            static SPEC T div(T a, T b) { return NS::div(a, b); }           \
+        };
+
+    #define ARITH_BACKEND(TAG, NAME, NS, T, AVAILABLE) ARITH_BACKEND_AS(inline, TAG, NAME, NS, T, AVAILABLE)
+    #define ARITH_CONSTEXPR_BACKEND(TAG, NAME, NS, T) ARITH_BACKEND_AS(constexpr, TAG, NAME, NS, T, true)
+
+    ARITH_CONSTEXPR_BACKEND(OldCBackend, "OldC", ::OldC, int)
+    ARITH_CONSTEXPR_BACKEND(CtCBackend, "CtC", ::CtC, int)
+    ARITH_CONSTEXPR_BACKEND(ModBackend, "Mod", ::Mod, int)
+    ARITH_CONSTEXPR_BACKEND(ModFBackend, "ModF", ::ModF, float)
+    ARITH_CONSTEXPR_BACKEND(Mod64Backend, "Mod", ::Mod, int64_t)
+    ARITH_CONSTEXPR_BACKEND(ModF64Backend, "ModF", ::ModF, double)
+
+    using Portable = List<OldCBackend, CtCBackend, ModBackend, ModFBackend, Mod64Backend, ModF64Backend>;
+
+    // Domain operand yang benar: OldC mul/div hanya untuk a >= 0, b > 0
+    template <typename B>
+    constexpr bool SignedDomain = true;
+
+    template <>
+    constexpr bool SignedDomain<OldCBackend> = false;
+}
+
+/* Backend asm per arsitektur, masing-masing mendefinisikan Arith::ArchBackends */
+#if defined(__x86_64__) || defined(__i386__)
+    #define ARITH_X86 1
+    #include "Arith_x86.hpp"
+#elif defined(__aarch64__)
+    #define ARITH_ARM 1
+    #include "Arith_ARM.hpp"
+#elif defined(__riscv)
+    #define ARITH_RISCV 1
+    #include "Arith_RISCV.hpp"
+#else
+    namespace Arith {
+        using ArchBackends = List<>;
+    }
+#endif
+
+// CONSTEXPR + ASM: di compile time dihitung compiler (Mod / ModF), di runtime
+// memanggil backend asm arsitektur ini (kalau ada). std::is_constant_evaluated
+// karena `if consteval` baru ada di C++23. Hanya gratis di konteks konstan
+// (constexpr var, static_assert, template arg): Cx::mul(6, 7) biasa tetap lewat asm
+namespace Cx {
+    #if defined(ARITH_ASM_INT)
+        namespace IntRt = ::Asm;
+    #else
+        namespace IntRt = ::Mod;
+    #endif
+    #if defined(ARITH_ASM_FLOAT)
+        namespace FloatRt = ::Asm;
+    #else
+        namespace FloatRt = ::ModF;
+    #endif
+    #if defined(ARITH_ASM_INT64)
+        namespace Int64Rt = ::Asm;
+    #else
+        namespace Int64Rt = ::Mod;
+    #endif
+    #if defined(ARITH_ASM_DOUBLE)
+        namespace DoubleRt = ::Asm;
+    #else
+        namespace DoubleRt = ::ModF;
+    #endif
+
+    #define CX_OP_T(NAME, T, CT, RT)                            \
+        constexpr T NAME(T a, T b) {                            \
+            if (std::is_constant_evaluated())                   \
+                return CT::NAME(a, b);                          \
+            return RT::NAME(a, b);                              \
+        }
+
+    #define CX_OP(NAME)                                         \
+        CX_OP_T(NAME, int, Mod, IntRt)                          \
+        CX_OP_T(NAME, float, ModF, FloatRt)                     \
+        CX_OP_T(NAME, int64_t, Mod, Int64Rt)                    \
+        CX_OP_T(NAME, double, ModF, DoubleRt)
+
+    CX_OP(add)
+    CX_OP(sub)
+    CX_OP(mul)
+    CX_OP(div)
+
+    #undef CX_OP
+    #undef CX_OP_T
+}
+
+namespace Arith {
+    ARITH_CONSTEXPR_BACKEND(CxIntBackend, "Cx", ::Cx, int)
+    ARITH_CONSTEXPR_BACKEND(CxFloatBackend, "Cx", ::Cx, float)
+    ARITH_CONSTEXPR_BACKEND(CxInt64Backend, "Cx", ::Cx, int64_t)
+    ARITH_CONSTEXPR_BACKEND(CxDoubleBackend, "Cx", ::Cx, double)
+
+    // Backend asm dulu, kemudian portable, terakhir Cx
+    using All = decltype(Concat(Concat(ArchBackends{}, Portable{}),
+                                List<CxIntBackend, CxFloatBackend, CxInt64Backend, CxDoubleBackend>{}));
+
+    // Tabel uji dihitung saat compile (consteval), dipakai untuk static_assert
+    // backend portable dan untuk cek backend asm di runtime (Check)
+    namespace Table {
+        template <typename T>
+        struct Case {
+            T a, b;
+            T add, sub, mul, div;
+        };
+
+        // |a * b| ≤ 46340² < INT_MAX, jadi Mod tidak overflow (UB = error di constexpr)
+        constexpr int IntA[] = {0, 1, -1, 2, -7, 17, 100, -12345, 46340, -46340};
+        constexpr int IntB[] = {1, -1, 3, -5, 7, 64, -1000, 46340};
+        constexpr float FloatA[] = {0.0f, 1.0f, -1.5f, 3.14f, -2.71f, 1e-3f, 123456.78f, -1e20f};
+        constexpr float FloatB[] = {1.0f, -1.0f, 3.0f, 0.1f, -7.25f, 1e10f};
+        // Operand dan hasil lewat 32 bit, tapi |a * b| ≤ 2^32 × 2e9 < 2^63
+        constexpr int64_t Int64A[] = {0, 1, -1, 7, -12345, 4294967296, -3000000000, 1234567890};
+        constexpr int64_t Int64B[] = {1, -1, 3, -1000, 65536, 1000000007, -2000000011};
+        constexpr double DoubleA[] = {0.0, 1.0, -1.5, 3.14, -2.71, 1e-300, 123456.789, -1e200};
+        constexpr double DoubleB[] = {1.0, -1.0, 3.0, 0.1, -7.25, 1e100};
+
+        template <typename T, size_t NA, size_t NB>
+        consteval auto Make(const T (&as)[NA], const T (&bs)[NB]) {
+            using Ref = std::conditional_t<std::is_same_v<T, int>, ModBackend,
+                        std::conditional_t<std::is_same_v<T, float>, ModFBackend,
+                        std::conditional_t<std::is_same_v<T, int64_t>, Mod64Backend, ModF64Backend>>>;
+            std::array<Case<T>, NA * NB> t{};
+            size_t k = 0;
+            for (T a : as) {
+                for (T b : bs)
+                    t[k++] = {a, b, Ref::add(a, b), Ref::sub(a, b), Ref::mul(a, b), Ref::div(a, b)};
+            }
+            return t;
+        }
+
+        constexpr auto Ints = Make(IntA, IntB);
+        constexpr auto Floats = Make(FloatA, FloatB);
+        constexpr auto Int64s = Make(Int64A, Int64B);
+        constexpr auto Doubles = Make(DoubleA, DoubleB);
+
+        // Berapa case yang tidak cocok; signedOk = false → hanya a >= 0, b > 0
+        template <typename NS, typename T, size_t N>
+        constexpr size_t Mismatch(const std::array<Case<T>, N>& t, bool signedOk = true) {
+            size_t bad = 0;
+            for (const auto& c : t) {
+                bad += NS::add(c.a, c.b) != c.add;
+                bad += NS::sub(c.a, c.b) != c.sub;
+                if (!signedOk && (c.a < 0 || c.b <= 0))
+                    continue;
+                bad += NS::mul(c.a, c.b) != c.mul;
+                bad += NS::div(c.a, c.b) != c.div;
+            }
+            return bad;
+        }
+
+        static_assert(Mismatch<OldCBackend>(Ints, false) == 0);
+        static_assert(Mismatch<CtCBackend>(Ints) == 0);
+        static_assert(Mismatch<CxIntBackend>(Ints) == 0);
+        static_assert(Mismatch<CxFloatBackend>(Floats) == 0);
+        static_assert(Mismatch<CxInt64Backend>(Int64s) == 0);
+        static_assert(Mismatch<CxDoubleBackend>(Doubles) == 0);
+        static_assert(Cx::mul(6, 7) == 42 && Cx::div(1.0f, 4.0f) == 0.25f);
+        static_assert(Cx::mul(int64_t(1) << 40, int64_t(3)) == int64_t(3) << 40);
+
+        // Pembagi invariant: case tabel yang sama (b jadi Divider), plus batas unsigned
+        template <typename T, size_t N>
+        constexpr size_t DivMismatch(const std::array<Case<T>, N>& t) {
+            size_t bad = 0;
+            for (const auto& c : t)
+                bad += InvDiv::Divider<T>(c.b)(c.a) != c.div;
+            return bad;
+        }
+
+        static_assert(DivMismatch(Ints) == 0 && DivMismatch(Int64s) == 0);
+        static_assert(InvDiv::Divider<int>(INT32_MIN)(INT32_MIN) == 1 && InvDiv::Divider<int>(-1)(INT32_MIN) == INT32_MIN);
+        static_assert(InvDiv::Divider<uint32_t>(7)(UINT32_MAX) == UINT32_MAX / 7);
+        static_assert(InvDiv::Divider<uint32_t>(0x80000001u)(UINT32_MAX) == 1);
+        static_assert(InvDiv::Divider<uint64_t>(36)(UINT64_MAX) == UINT64_MAX / 36);
+        static_assert(InvDiv::Divider<uint64_t>(UINT64_MAX)(UINT64_MAX - 1) == 0);
+        static_assert(InvDiv::Divider<int64_t>(INT64_MIN)(INT64_MIN) == 1 && InvDiv::Divider<int64_t>(-7)(INT64_MAX) == INT64_MAX / -7);
+
+        // half / bfloat16: round-trip exact, RNE di titik tengah, batas subnormal / inf
+        static_assert(Half::FromFloat(1.0f) == 0x3C00 && Half::ToFloat(0x3C00) == 1.0f);
+        static_assert(Half::FromFloat(65504.0f) == 0x7BFF && Half::FromFloat(65520.0f) == 0x7C00);
+        static_assert(Half::FromFloat(0x1p-24f) == 0x0001 && Half::FromFloat(0x1p-25f) == 0x0000);
+        static_assert(Half::FromFloat(1.0f + 0x1p-11f) == 0x3C00 && Half::FromFloat(1.0f + 0x3p-11f) == 0x3C02);
+        static_assert(BFloat::FromFloat(1.0f) == 0x3F80 && BFloat::ToFloat(0x3F80) == 1.0f);
+        static_assert(BFloat::FromFloat(1.0f + 0x1p-8f) == 0x3F80 && BFloat::FromFloat(1.0f + 0x3p-8f) == 0x3F82);
+
+        // Runtime: backend apa pun (termasuk asm) terhadap tabel compile time
+        template <typename B>
+        size_t Check() {
+            using T = typename B::Type;
+            if constexpr (std::is_same_v<T, int>)
+                return Mismatch<B>(Ints, SignedDomain<B>);
+            else if constexpr (std::is_same_v<T, float>)
+                return Mismatch<B>(Floats);
+            else if constexpr (std::is_same_v<T, int64_t>)
+                return Mismatch<B>(Int64s);
+            else
+                return Mismatch<B>(Doubles);
+        }
+    }
+}
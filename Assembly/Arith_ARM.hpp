@@ -0,0 +1,103 @@
+// Arith_ARM.hpp — backend asm AArch64 (hanya di-include dari Arith.hpp)
+// Asm: GPR (w register, 32-bit) + FP scalar (s register)
+#pragma once
+
+#define ARITH_ASM_INT 1
+#define ARITH_ASM_FLOAT 1
+
+namespace Asm {
+    // ARM ADD
+    inline int add(int x, int y){
+        int result;
+        asm volatile(
+            "add %w0, %w1, %w2\n"
+            : "=r"(result)
+            : "r"(x), "r"(y)
+        );
+        return result;
+    }
+
+    // ARM SUB
+    inline int sub(int x, int y){
+        int result;
+        asm volatile(
+            "sub %w0, %w1, %w2\n"
+            : "=r"(result)
+            : "r"(x), "r"(y)
+        );
+        return result;
+    }
+
+    // ARM MUL (AArch64: MUL is always available)
+    inline int mul(int x, int y){
+        int result;
+        asm volatile(
+            "mul %w0, %w1, %w2\n"
+            : "=r"(result)
+            : "r"(x), "r"(y)
+        );
+        return result;
+    }
+
+    // ARM DIV (SDIV = signed divide)
+    inline int div(int x, int y){
+        int result;
+        asm volatile(
+            "sdiv %w0, %w1, %w2\n"
+            : "=r"(result)
+            : "r"(x), "r"(y)
+        );
+        return result;
+    }
+
+}
+
+// ARM ASM Float
+namespace Asm {
+    inline float add(float x, float y){
+        float result;
+        asm volatile(
+            "fadd %s0, %s1, %s2"
+            : "=w"(result)
+            : "w"(x), "w"(y)
+        );
+        return result;
+    }
+
+    inline float sub(float x, float y){
+        float result;
+        asm volatile(
+            "fsub %s0, %s1, %s2"
+            : "=w"(result)
+            : "w"(x), "w"(y)
+        );
+        return result;
+    }
+
+    inline float mul(float x, float y){
+        float result;
+        asm volatile(
+            "fmul %s0, %s1, %s2"
+            : "=w"(result)
+            : "w"(x), "w"(y)
+        );
+        return result;
+    }
+
+    inline float div(float x, float y){
+        float result;
+        asm volatile(
+            "fdiv %s0, %s1, %s2"
+            : "=w"(result)
+            : "w"(x), "w"(y)
+        );
+        return result;
+    }
+}
+
+namespace Arith {
+    ARITH_BACKEND(AsmIntBackend, "Asm", ::Asm, int, true)
+    ARITH_BACKEND(AsmFloatBackend, "Asm", ::Asm, float, true)
+
+    using ArchBackends = List<AsmIntBackend, AsmFloatBackend>;
+}
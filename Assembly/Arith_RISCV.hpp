@@ -0,0 +1,111 @@
+// Arith_RISCV.hpp — backend asm RISC-V (hanya di-include dari Arith.hpp)
+// Asm int butuh extension M; Asm float hanya ada kalau target punya F (__riscv_flen)
+#pragma once
+
+#define ARITH_ASM_INT 1
+#if defined(__riscv_flen)
+    #define ARITH_ASM_FLOAT 1
+#endif
+
+namespace Asm {
+    // RISC-V ADD
+    inline int add(int x, int y){
+        int result;
+        asm volatile(
+            "add %0, %1, %2"
+            : "=r"(result)
+            : "r"(x), "r"(y)
+        );
+        return result;
+    }
+
+    // RISC-V SUB
+    inline int sub(int x, int y){
+        int result;
+        asm volatile(
+            "sub %0, %1, %2"
+            : "=r"(result)
+            : "r"(x), "r"(y)
+        );
+        return result;
+    }
+
+    // RISC-V MUL (IM extension
+    inline int mul(int x, int y){
+        int result;
+        asm volatile(
+            "mul %0, %1, %2"
+            : "=r"(result)
+            : "r"(x), "r"(y)
+        );
+        return result;
+    }
+
+    // RISC-V DIV (IM extension
+    inline int div(int x, int y){
+        int result;
+        asm volatile(
+            "div %0, %1, %2"
+            : "=r"(result)
+            : "r"(x), "r"(y)
+        );
+        return result;
+    }
+
+} // namespace Asm
+
+#if defined(__riscv_flen)
+// RISC-V Float
+namespace Asm {
+    inline float add(float x, float y){
+        float result;
+        asm volatile(
+            "fadd.s %0, %1, %2"
+            : "=f"(result)     // output
+            : "f"(x), "f"(y)   // input
+        );
+        return result;
+    }
+
+    inline float sub(float x, float y){
+        float result;
+        asm volatile(
+            "fsub.s %0, %1, %2"
+            : "=f"(result)
+            : "f"(x), "f"(y)
+        );
+        return result;
+    }
+
+    inline float mul(float x, float y){
+        float result;
+        asm volatile(
+            "fmul.s %0, %1, %2"
+            : "=f"(result)
+            : "f"(x), "f"(y)
+        );
+        return result;
+    }
+
+    inline float div(float x, float y){
+        float result;
+        asm volatile(
+            "fdiv.s %0, %1, %2"
+            : "=f"(result)
+            : "f"(x), "f"(y)
+        );
+        return result;
+    }
+}
+#endif
+
+namespace Arith {
+    ARITH_BACKEND(AsmIntBackend, "Asm", ::Asm, int, true)
+#if defined(__riscv_flen)
+    ARITH_BACKEND(AsmFloatBackend, "Asm", ::Asm, float, true)
+
+    using ArchBackends = List<AsmIntBackend, AsmFloatBackend>;
+#else
+    using ArchBackends = List<AsmIntBackend>;
+#endif
+}
@@ -0,0 +1,1202 @@
+// Arith_x86.hpp — backend asm x86 (hanya di-include dari Arith.hpp)
+// Asm: GPR + SSE scalar, LAsm: x87, HAsm: VEX 3-operand, VAsm: packed SSE/AVX/AVX-512
+// (float / double, half / bfloat16 lewat konversi F16C / AVX2, dan int / int64 dibagi pembagi invariant)
+#pragma once
+
+#define ARITH_ASM_INT 1
+#define ARITH_ASM_FLOAT 1
+#define ARITH_ASM_DOUBLE 1
+#if defined(__x86_64__)
+    #define ARITH_ASM_INT64 1
+#endif
+
+// ASM int
+namespace Asm {
+    // x86 ADD
+    inline int add(int x, int y) {
+        int result;
+        asm volatile(
+            "movl %1, %%eax;"      // eax = x
+            "addl %2, %%eax;"      // eax = eax + y
+            : "=a"(result)         // output: result <- eax
+            : "r"(x), "r"(y)       // input operands
+            : "cc"                 // clobbers flags
+            );
+        return result;
+    }
+
+    // x86 SUB
+    inline int sub(int x, int y) {
+        int result;
+        asm volatile(
+            "movl %1, %%eax;"
+            "subl %2, %%eax;"      // eax = x - y
+            : "=a"(result)
+            : "r"(x), "r"(y)
+            : "cc"
+            );
+        return result;
+    }
+
+    // x86 MUL (signed IMUL)
+    inline int mul(int x, int y) {
+        int result;
+        asm volatile(
+            "movl %1, %%eax;"
+            "imull %2, %%eax;"     // eax *= y
+            : "=a"(result)
+            : "r"(x), "r"(y)
+            : "cc"
+            );
+        return result;
+    }
+
+    // x86 DIV (signed IDIV)
+    inline int div(int x, int y) {
+        int result;
+        asm volatile(
+            "movl %1, %%eax;"      // eax = x
+            "cdq;"                 // sign extend eax -> edx:eax
+            "idivl %2;"            // eax = (edx:eax) / y
+            : "=a"(result)
+            : "r"(x), "r"(y)
+            : "edx", "cc"
+            );
+        return result;
+    }
+
+} 
+
+// X86 Legacy ASM float
+namespace LAsm {
+    inline float add(float x, float y){
+        float result;
+        asm volatile(
+            "flds %1\n\t"        // st(0) = x
+            "flds %2\n\t"        // st(0) = y, st(1) = x
+            "faddp\n\t"           // st(1) = x + y, pop
+            "fstps %0"           // store to result, pop
+            : "=m"(result)
+            : "m"(x), "m"(y)
+        );
+        return result;
+    }
+
+    inline float sub(float x, float y){
+        float result;
+        asm volatile(
+            "flds %1\n\t"        // x
+            "flds %2\n\t"        // y
+            "fsubrp\n\t"          // st(1) = st(1) - st(0) = x - y, pop (AT&T: mnemonic "r" terbalik)
+            "fstps %0"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+        );
+        return result;
+    }
+
+    inline float mul(float x, float y){
+        float result;
+        asm volatile(
+            "flds %1\n\t"        // x
+            "flds %2\n\t"        // y
+            "fmulp\n\t"           // st(1) = x * y, pop
+            "fstps %0"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+        );
+        return result;
+    }
+
+    inline float div(float x, float y){
+        float result;
+        asm volatile(
+            "flds %1\n\t"        // x
+            "flds %2\n\t"        // y
+            "fdivrp\n\t"          // st(1) = st(1) / st(0) = x / y, pop
+            "fstps %0"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+        );
+        return result;
+    }
+
+}
+
+
+// X86 ASM float
+namespace Asm {
+    inline float add(float x, float y){
+        float result;
+        asm volatile(
+            "movss %1, %%xmm0\n\t"
+            "addss %2, %%xmm0\n\t"
+            "movss %%xmm0, %0\n\t"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+            : "xmm0"
+        );
+        return result;
+    }
+
+    inline float sub(float x, float y){
+        float result;
+        asm volatile(
+            "movss %1, %%xmm0\n\t"
+            "subss %2, %%xmm0\n\t"
+            "movss %%xmm0, %0\n\t"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+            : "xmm0"
+        );
+        return result;
+    }
+
+    inline float mul(float x, float y){
+        float result;
+        asm volatile(
+            "movss %1, %%xmm0\n\t"
+            "mulss %2, %%xmm0\n\t"
+            "movss %%xmm0, %0\n\t"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+            : "xmm0"
+        );
+        return result;
+    }
+
+    inline float div(float x, float y){
+        float result;
+        asm volatile(
+            "movss %1, %%xmm0\n\t"
+            "divss %2, %%xmm0\n\t"
+            "movss %%xmm0, %0\n\t"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+            : "xmm0"
+        );
+        return result;
+    }
+}
+
+// X86 HPC ASM float
+// Rule (Intel): vop dest, src1, src2 ; dest = src1 op src2
+// AT&T (GCC asm) urutannya terbalik: vop src2, src1, dest
+namespace HAsm {
+    inline float add(float x, float y){
+        float result;
+        asm volatile(
+            "vaddss %2, %1, %0"
+            : "=x"(result)
+            : "x"(x), "x"(y)
+        );
+        return result;
+    }
+
+    inline float sub(float x, float y){
+        float result;
+        asm volatile(
+            "vsubss %2, %1, %0"
+            : "=x"(result)
+            : "x"(x), "x"(y)
+        );
+        return result;
+    }
+
+    inline float mul(float x, float y){
+        float result;
+        asm volatile(
+            "vmulss %2, %1, %0"
+            : "=x"(result)
+            : "x"(x), "x"(y)
+        );
+        return result;
+    }
+
+    inline float div(float x, float y){
+        float result;
+        asm volatile(
+            "vdivss %2, %1, %0"
+            : "=x"(result)
+            : "x"(x), "x"(y)
+        );
+        return result;
+    }
+}
+
+// 64-bit: int64 (GPR 64-bit, hanya x86-64) dan double (x87 fldl, SSE2 sd, VEX sd)
+#if defined(__x86_64__)
+namespace Asm {
+    inline int64_t add(int64_t x, int64_t y) {
+        int64_t result;
+        asm volatile(
+            "movq %1, %%rax;"
+            "addq %2, %%rax;"
+            : "=a"(result)
+            : "r"(x), "r"(y)
+            : "cc"
+            );
+        return result;
+    }
+
+    inline int64_t sub(int64_t x, int64_t y) {
+        int64_t result;
+        asm volatile(
+            "movq %1, %%rax;"
+            "subq %2, %%rax;"
+            : "=a"(result)
+            : "r"(x), "r"(y)
+            : "cc"
+            );
+        return result;
+    }
+
+    inline int64_t mul(int64_t x, int64_t y) {
+        int64_t result;
+        asm volatile(
+            "movq %1, %%rax;"
+            "imulq %2, %%rax;"
+            : "=a"(result)
+            : "r"(x), "r"(y)
+            : "cc"
+            );
+        return result;
+    }
+
+    // cqo: sign extend rax -> rdx:rax
+    inline int64_t div(int64_t x, int64_t y) {
+        int64_t result;
+        asm volatile(
+            "movq %1, %%rax;"
+            "cqo;"
+            "idivq %2;"
+            : "=a"(result)
+            : "r"(x), "r"(y)
+            : "rdx", "cc"
+            );
+        return result;
+    }
+}
+#endif
+
+namespace LAsm {
+    inline double add(double x, double y){
+        double result;
+        asm volatile(
+            "fldl %1\n\t"
+            "fldl %2\n\t"
+            "faddp\n\t"           // st(1) = x + y, pop
+            "fstpl %0"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+        );
+        return result;
+    }
+
+    inline double sub(double x, double y){
+        double result;
+        asm volatile(
+            "fldl %1\n\t"
+            "fldl %2\n\t"
+            "fsubrp\n\t"
+            "fstpl %0"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+        );
+        return result;
+    }
+
+    inline double mul(double x, double y){
+        double result;
+        asm volatile(
+            "fldl %1\n\t"
+            "fldl %2\n\t"
+            "fmulp\n\t"           // st(1) = x * y, pop
+            "fstpl %0"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+        );
+        return result;
+    }
+
+    inline double div(double x, double y){
+        double result;
+        asm volatile(
+            "fldl %1\n\t"
+            "fldl %2\n\t"
+            "fdivrp\n\t"
+            "fstpl %0"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+        );
+        return result;
+    }
+}
+
+namespace Asm {
+    inline double add(double x, double y){
+        double result;
+        asm volatile(
+            "movsd %1, %%xmm0\n\t"
+            "addsd %2, %%xmm0\n\t"
+            "movsd %%xmm0, %0\n\t"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+            : "xmm0"
+        );
+        return result;
+    }
+
+    inline double sub(double x, double y){
+        double result;
+        asm volatile(
+            "movsd %1, %%xmm0\n\t"
+            "subsd %2, %%xmm0\n\t"
+            "movsd %%xmm0, %0\n\t"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+            : "xmm0"
+        );
+        return result;
+    }
+
+    inline double mul(double x, double y){
+        double result;
+        asm volatile(
+            "movsd %1, %%xmm0\n\t"
+            "mulsd %2, %%xmm0\n\t"
+            "movsd %%xmm0, %0\n\t"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+            : "xmm0"
+        );
+        return result;
+    }
+
+    inline double div(double x, double y){
+        double result;
+        asm volatile(
+            "movsd %1, %%xmm0\n\t"
+            "divsd %2, %%xmm0\n\t"
+            "movsd %%xmm0, %0\n\t"
+            : "=m"(result)
+            : "m"(x), "m"(y)
+            : "xmm0"
+        );
+        return result;
+    }
+}
+
+namespace HAsm {
+    inline double add(double x, double y){
+        double result;
+        asm volatile(
+            "vaddsd %2, %1, %0"
+            : "=x"(result)
+            : "x"(x), "x"(y)
+        );
+        return result;
+    }
+
+    inline double sub(double x, double y){
+        double result;
+        asm volatile(
+            "vsubsd %2, %1, %0"
+            : "=x"(result)
+            : "x"(x), "x"(y)
+        );
+        return result;
+    }
+
+    inline double mul(double x, double y){
+        double result;
+        asm volatile(
+            "vmulsd %2, %1, %0"
+            : "=x"(result)
+            : "x"(x), "x"(y)
+        );
+        return result;
+    }
+
+    inline double div(double x, double y){
+        double result;
+        asm volatile(
+            "vdivsd %2, %1, %0"
+            : "=x"(result)
+            : "x"(x), "x"(y)
+        );
+        return result;
+    }
+}
+
+// CPUID / XGETBV untuk dispatch runtime
+// Fitur harus didukung CPU *dan* OS (XCR0 menyimpan state register vector saat context switch)
+namespace Cpu {
+    struct Regs { uint32_t a, b, c, d; };
+
+    inline Regs cpuid(uint32_t leaf, uint32_t sub = 0) {
+        Regs r;
+        asm volatile(
+            "cpuid"
+            : "=a"(r.a), "=b"(r.b), "=c"(r.c), "=d"(r.d)
+            : "a"(leaf), "c"(sub)
+        );
+        return r;
+    }
+
+    inline uint64_t xgetbv(uint32_t index) {
+        uint32_t lo, hi;
+        asm volatile(
+            "xgetbv"
+            : "=a"(lo), "=d"(hi)
+            : "c"(index)
+        );
+        return (uint64_t)hi << 32 | lo;
+    }
+
+    inline bool HasSSE() {
+        return cpuid(1).d >> 25 & 1;
+    }
+
+    // AVX + OSXSAVE, XCR0 bit 1-2 (xmm, ymm)
+    inline bool HasAVX() {
+        Regs r = cpuid(1);
+        bool osxsave = r.c >> 27 & 1, avx = r.c >> 28 & 1;
+        return osxsave && avx && (xgetbv(0) & 0x6) == 0x6;
+    }
+
+    // F16C (vcvtph2ps / vcvtps2ph) butuh state ymm yang sama dengan AVX
+    inline bool HasF16C() {
+        return HasAVX() && (cpuid(1).c >> 29 & 1);
+    }
+
+    // FMA3 (vfmadd*), state ymm sama dengan AVX
+    inline bool HasFMA() {
+        return HasAVX() && (cpuid(1).c >> 12 & 1);
+    }
+
+    inline bool HasAVX2() {
+        return HasAVX() && cpuid(0).a >= 7 && (cpuid(7).b >> 5 & 1);
+    }
+
+    // AVX-512F, XCR0 bit 5-7 (opmask, zmm0-15 upper, zmm16-31)
+    inline bool HasAVX512() {
+        if (!HasAVX() || cpuid(0).a < 7)
+            return false;
+        return (cpuid(7).b >> 16 & 1) && (xgetbv(0) & 0xE6) == 0xE6;
+    }
+}
+
+// X86 packed ASM (array)
+// o[i] = x[i] op y[i], 1 instruksi untuk 4 / 2 (SSE), 8 / 4 (AVX), 16 / 8 (AVX-512) float / double.
+// Loop ditulis penuh di asm; sisa n % lebar dikerjakan scalar (ModF).
+// F16C / BF16: storage 16-bit (setengah bandwidth float), convert ke float di register, op ps, convert balik
+namespace VAsm {
+    template <typename T>
+    using FnT = void (*)(const T* x, const T* y, T* o, size_t n);
+    using Fn = FnT<float>;
+    using FnD = FnT<double>;
+    using Fn16 = FnT<uint16_t>;
+
+    // Sisa elemen yang tidak muat 1 vector
+    template <typename T, typename Op>
+    inline void tail(const T* x, const T* y, T* o, size_t from, size_t n, Op op) {
+        for (size_t i = from; i < n; i++)
+            o[i] = op(x[i], y[i]);
+    }
+
+    // SSE: operand memory non-VEX wajib align 16, jadi y di-load dulu dengan movups.
+    // SCALE = ukuran elemen (4 float, 8 double), STEP = elemen per register
+    #define SSE_LOOP(OP, SCALE, STEP)                    \
+        asm volatile(                                    \
+            "1:\n\t"                                     \
+            "movups (%[x],%[i]," SCALE "), %%xmm0\n\t"   \
+            "movups (%[y],%[i]," SCALE "), %%xmm1\n\t"   \
+            OP " %%xmm1, %%xmm0\n\t"                     \
+            "movups %%xmm0, (%[o],%[i]," SCALE ")\n\t"   \
+            "add $" STEP ", %[i]\n\t"                    \
+            "cmp %[n], %[i]\n\t"                         \
+            "jb 1b"                                      \
+            : [i] "+r"(i)                                \
+            : [x] "r"(x), [y] "r"(y), [o] "r"(o), [n] "r"(body) \
+            : "xmm0", "xmm1", "cc", "memory"             \
+        )
+
+    // VEX / EVEX: operand memory boleh unaligned. vzeroupper di akhir supaya
+    // kode SSE setelahnya tidak kena penalti transisi state AVX
+    #define VEX_LOOP(OP, REG, SCALE, STEP)               \
+        asm volatile(                                    \
+            "1:\n\t"                                     \
+            "vmovups (%[x],%[i]," SCALE "), %%" REG "0\n\t" \
+            OP " (%[y],%[i]," SCALE "), %%" REG "0, %%" REG "0\n\t" \
+            "vmovups %%" REG "0, (%[o],%[i]," SCALE ")\n\t" \
+            "add $" STEP ", %[i]\n\t"                    \
+            "cmp %[n], %[i]\n\t"                         \
+            "jb 1b\n\t"                                  \
+            "vzeroupper"                                 \
+            : [i] "+r"(i)                                \
+            : [x] "r"(x), [y] "r"(y), [o] "r"(o), [n] "r"(body) \
+            : "xmm0", "cc", "memory"                     \
+        )
+
+    // half → float (vcvtph2ps), op, float → half RNE (vcvtps2ph imm 0), 8 elemen per ymm
+    #define F16C_LOOP(OP)                                \
+        asm volatile(                                    \
+            "1:\n\t"                                     \
+            "vcvtph2ps (%[x],%[i],2), %%ymm0\n\t"        \
+            "vcvtph2ps (%[y],%[i],2), %%ymm1\n\t"        \
+            OP " %%ymm1, %%ymm0, %%ymm0\n\t"             \
+            "vcvtps2ph $0, %%ymm0, (%[o],%[i],2)\n\t"    \
+            "add $8, %[i]\n\t"                           \
+            "cmp %[n], %[i]\n\t"                         \
+            "jb 1b\n\t"                                  \
+            "vzeroupper"                                 \
+            : [i] "+r"(i)                                \
+            : [x] "r"(x), [y] "r"(y), [o] "r"(o), [n] "r"(body) \
+            : "xmm0", "xmm1", "cc", "memory"             \
+        )
+
+    // bfloat16 → float = zero-extend + geser 16 (AVX2). Balik: RNE u + 0x7FFF + lsb,
+    // NaN (vcmpunordps) tidak dibulatkan tapi di-quiet (| 0x40), lalu pack 32 → 16 bit
+    #define BF16_LOOP(OP)                                \
+        asm volatile(                                    \
+            "vpbroadcastd %[one], %%ymm5\n\t"            \
+            "vpbroadcastd %[bias], %%ymm6\n\t"           \
+            "vpbroadcastd %[qnan], %%ymm7\n\t"           \
+            "1:\n\t"                                     \
+            "vpmovzxwd (%[x],%[i],2), %%ymm0\n\t"        \
+            "vpslld $16, %%ymm0, %%ymm0\n\t"             \
+            "vpmovzxwd (%[y],%[i],2), %%ymm1\n\t"        \
+            "vpslld $16, %%ymm1, %%ymm1\n\t"             \
+            OP " %%ymm1, %%ymm0, %%ymm0\n\t"             \
+            "vpsrld $16, %%ymm0, %%ymm2\n\t"             \
+            "vpand %%ymm5, %%ymm2, %%ymm3\n\t"           \
+            "vpaddd %%ymm6, %%ymm0, %%ymm4\n\t"          \
+            "vpaddd %%ymm3, %%ymm4, %%ymm4\n\t"          \
+            "vpsrld $16, %%ymm4, %%ymm4\n\t"             \
+            "vpor %%ymm7, %%ymm2, %%ymm2\n\t"            \
+            "vcmpunordps %%ymm0, %%ymm0, %%ymm3\n\t"     \
+            "vblendvps %%ymm3, %%ymm2, %%ymm4, %%ymm4\n\t" \
+            "vextracti128 $1, %%ymm4, %%xmm3\n\t"        \
+            "vpackusdw %%xmm3, %%xmm4, %%xmm4\n\t"       \
+            "vmovdqu %%xmm4, (%[o],%[i],2)\n\t"          \
+            "add $8, %[i]\n\t"                           \
+            "cmp %[n], %[i]\n\t"                         \
+            "jb 1b\n\t"                                  \
+            "vzeroupper"                                 \
+            : [i] "+r"(i)                                \
+            : [x] "r"(x), [y] "r"(y), [o] "r"(o), [n] "r"(body), \
+              [one] "m"(one), [bias] "m"(bias), [qnan] "m"(qnan) \
+            : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", "cc", "memory" \
+        )
+
+    #define PACKED_KERNEL(NAME, T, WIDTH, LOOP, SCALAR)              \
+        inline void NAME(const T* x, const T* y, T* o, size_t n) {   \
+            size_t i = 0, body = n - n % WIDTH;                      \
+            if (body)                                                \
+                LOOP;                                                \
+            tail(x, y, o, body, n, [](T a, T b) { return SCALAR(a, b); }); \
+        }
+
+    // Storage 16-bit, tail lewat konversi scalar yang sama (FMT = Half / BFloat)
+    #define CONVERT_KERNEL(NAME, FMT, LOOP, SCALAR)                  \
+        inline void NAME(const uint16_t* x, const uint16_t* y, uint16_t* o, size_t n) { \
+            [[maybe_unused]] const uint32_t one = 1, bias = 0x7FFF, qnan = 0x40; \
+            size_t i = 0, body = n - n % 8;                          \
+            if (body)                                                \
+                LOOP;                                                \
+            tail(x, y, o, body, n, [](uint16_t a, uint16_t b) {      \
+                return FMT::FromFloat(SCALAR(FMT::ToFloat(a), FMT::ToFloat(b))); \
+            });                                                      \
+        }
+
+    namespace SSE {
+        PACKED_KERNEL(add, float, 4, SSE_LOOP("addps", "4", "4"), ModF::add)
+        PACKED_KERNEL(sub, float, 4, SSE_LOOP("subps", "4", "4"), ModF::sub)
+        PACKED_KERNEL(mul, float, 4, SSE_LOOP("mulps", "4", "4"), ModF::mul)
+        PACKED_KERNEL(div, float, 4, SSE_LOOP("divps", "4", "4"), ModF::div)
+
+        PACKED_KERNEL(add, double, 2, SSE_LOOP("addpd", "8", "2"), ModF::add)
+        PACKED_KERNEL(sub, double, 2, SSE_LOOP("subpd", "8", "2"), ModF::sub)
+        PACKED_KERNEL(mul, double, 2, SSE_LOOP("mulpd", "8", "2"), ModF::mul)
+        PACKED_KERNEL(div, double, 2, SSE_LOOP("divpd", "8", "2"), ModF::div)
+    }
+
+    // ymm: vaddps 256-bit cukup AVX (AVX2 hanya menambah integer 256-bit)
+    namespace AVX {
+        PACKED_KERNEL(add, float, 8, VEX_LOOP("vaddps", "ymm", "4", "8"), ModF::add)
+        PACKED_KERNEL(sub, float, 8, VEX_LOOP("vsubps", "ymm", "4", "8"), ModF::sub)
+        PACKED_KERNEL(mul, float, 8, VEX_LOOP("vmulps", "ymm", "4", "8"), ModF::mul)
+        PACKED_KERNEL(div, float, 8, VEX_LOOP("vdivps", "ymm", "4", "8"), ModF::div)
+
+        PACKED_KERNEL(add, double, 4, VEX_LOOP("vaddpd", "ymm", "8", "4"), ModF::add)
+        PACKED_KERNEL(sub, double, 4, VEX_LOOP("vsubpd", "ymm", "8", "4"), ModF::sub)
+        PACKED_KERNEL(mul, double, 4, VEX_LOOP("vmulpd", "ymm", "8", "4"), ModF::mul)
+        PACKED_KERNEL(div, double, 4, VEX_LOOP("vdivpd", "ymm", "8", "4"), ModF::div)
+    }
+
+    namespace AVX512 {
+        PACKED_KERNEL(add, float, 16, VEX_LOOP("vaddps", "zmm", "4", "16"), ModF::add)
+        PACKED_KERNEL(sub, float, 16, VEX_LOOP("vsubps", "zmm", "4", "16"), ModF::sub)
+        PACKED_KERNEL(mul, float, 16, VEX_LOOP("vmulps", "zmm", "4", "16"), ModF::mul)
+        PACKED_KERNEL(div, float, 16, VEX_LOOP("vdivps", "zmm", "4", "16"), ModF::div)
+
+        PACKED_KERNEL(add, double, 8, VEX_LOOP("vaddpd", "zmm", "8", "8"), ModF::add)
+        PACKED_KERNEL(sub, double, 8, VEX_LOOP("vsubpd", "zmm", "8", "8"), ModF::sub)
+        PACKED_KERNEL(mul, double, 8, VEX_LOOP("vmulpd", "zmm", "8", "8"), ModF::mul)
+        PACKED_KERNEL(div, double, 8, VEX_LOOP("vdivpd", "zmm", "8", "8"), ModF::div)
+    }
+
+    // IEEE half, butuh F16C
+    namespace F16C {
+        CONVERT_KERNEL(add, Half, F16C_LOOP("vaddps"), ModF::add)
+        CONVERT_KERNEL(sub, Half, F16C_LOOP("vsubps"), ModF::sub)
+        CONVERT_KERNEL(mul, Half, F16C_LOOP("vmulps"), ModF::mul)
+        CONVERT_KERNEL(div, Half, F16C_LOOP("vdivps"), ModF::div)
+    }
+
+    // bfloat16, butuh AVX2 (vpmovzxwd / vpslld ymm)
+    namespace BF16 {
+        CONVERT_KERNEL(add, BFloat, BF16_LOOP("vaddps"), ModF::add)
+        CONVERT_KERNEL(sub, BFloat, BF16_LOOP("vsubps"), ModF::sub)
+        CONVERT_KERNEL(mul, BFloat, BF16_LOOP("vmulps"), ModF::mul)
+        CONVERT_KERNEL(div, BFloat, BF16_LOOP("vdivps"), ModF::div)
+    }
+
+    // Pembagian approx: x * rcp(y), rcp = rcpps / vrcpps (rel err ≤ 1.5 * 2^-12) atau
+    // vrcp14ps (2^-14), lalu STEPS langkah Newton–Raphson r = r * (2 - y * r) (bit benar ~2x per langkah).
+    // Tanpa penanganan khusus: y = 0 / inf / denormal / |y| > 2^126 memberi NaN atau 0, bukan hasil IEEE.
+    // Tail (n % lebar) pakai div penuh
+    #define SSE_NR                                       \
+        "movaps %%xmm1, %%xmm4\n\t"                      \
+        "mulps %%xmm2, %%xmm4\n\t"                       \
+        "movaps %%xmm3, %%xmm5\n\t"                      \
+        "subps %%xmm4, %%xmm5\n\t"                       \
+        "mulps %%xmm5, %%xmm2\n\t"
+
+    #define VEX_NR                                       \
+        "vmulps %%ymm2, %%ymm1, %%ymm4\n\t"              \
+        "vsubps %%ymm4, %%ymm3, %%ymm4\n\t"              \
+        "vmulps %%ymm4, %%ymm2, %%ymm2\n\t"
+
+    // AVX-512F selalu punya FMA: e = 1 - y * r, r = r + r * e (1 pembulatan lebih sedikit)
+    #define EVEX_NR                                      \
+        "vmovaps %%zmm3, %%zmm4\n\t"                     \
+        "vfnmadd231ps %%zmm2, %%zmm1, %%zmm4\n\t"        \
+        "vfmadd231ps %%zmm4, %%zmm2, %%zmm2\n\t"
+
+    #define SSE_RCP_LOOP(NR)                             \
+        asm volatile(                                    \
+            "movss %[k], %%xmm3\n\t"                     \
+            "shufps $0, %%xmm3, %%xmm3\n\t"              \
+            "1:\n\t"                                     \
+            "movups (%[x],%[i],4), %%xmm0\n\t"           \
+            "movups (%[y],%[i],4), %%xmm1\n\t"           \
+            "rcpps %%xmm1, %%xmm2\n\t"                   \
+            NR                                           \
+            "mulps %%xmm2, %%xmm0\n\t"                   \
+            "movups %%xmm0, (%[o],%[i],4)\n\t"           \
+            "add $4, %[i]\n\t"                           \
+            "cmp %[n], %[i]\n\t"                         \
+            "jb 1b"                                      \
+            : [i] "+r"(i)                                \
+            : [x] "r"(x), [y] "r"(y), [o] "r"(o), [n] "r"(body), [k] "m"(k) \
+            : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "cc", "memory" \
+        )
+
+    #define VEX_RCP_LOOP(RCP, REG, STEP, NR)             \
+        asm volatile(                                    \
+            "vbroadcastss %[k], %%" REG "3\n\t"          \
+            "1:\n\t"                                     \
+            "vmovups (%[x],%[i],4), %%" REG "0\n\t"      \
+            "vmovups (%[y],%[i],4), %%" REG "1\n\t"      \
+            RCP " %%" REG "1, %%" REG "2\n\t"            \
+            NR                                           \
+            "vmulps %%" REG "2, %%" REG "0, %%" REG "0\n\t" \
+            "vmovups %%" REG "0, (%[o],%[i],4)\n\t"      \
+            "add $" STEP ", %[i]\n\t"                    \
+            "cmp %[n], %[i]\n\t"                         \
+            "jb 1b\n\t"                                  \
+            "vzeroupper"                                 \
+            : [i] "+r"(i)                                \
+            : [x] "r"(x), [y] "r"(y), [o] "r"(o), [n] "r"(body), [k] "m"(k) \
+            : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "cc", "memory" \
+        )
+
+    // rdiv<0 / 1 / 2>: jumlah langkah Newton–Raphson. K = konstanta NR di register 3 (2 atau 1)
+    #define RCP_KERNEL(WIDTH, K, LOOP0, LOOP1, LOOP2)                \
+        template <int Steps>                                         \
+        inline void rdiv(const float* x, const float* y, float* o, size_t n) { \
+            static_assert(Steps >= 0 && Steps <= 2, "Newton-Raphson steps: 0, 1, 2"); \
+            [[maybe_unused]] const float k = K;                      \
+            size_t i = 0, body = n - n % WIDTH;                      \
+            if (body) {                                              \
+                if constexpr (Steps == 0) LOOP0;                     \
+                else if constexpr (Steps == 1) LOOP1;                \
+                else LOOP2;                                          \
+            }                                                        \
+            tail(x, y, o, body, n, [](float a, float b) { return ModF::div(a, b); }); \
+        }
+
+    namespace SSE {
+        RCP_KERNEL(4, 2.0f, SSE_RCP_LOOP(""), SSE_RCP_LOOP(SSE_NR), SSE_RCP_LOOP(SSE_NR SSE_NR))
+    }
+
+    namespace AVX {
+        RCP_KERNEL(8, 2.0f, VEX_RCP_LOOP("vrcpps", "ymm", "8", ""),
+                   VEX_RCP_LOOP("vrcpps", "ymm", "8", VEX_NR),
+                   VEX_RCP_LOOP("vrcpps", "ymm", "8", VEX_NR VEX_NR))
+    }
+
+    namespace AVX512 {
+        RCP_KERNEL(16, 1.0f, VEX_RCP_LOOP("vrcp14ps", "zmm", "16", ""),
+                   VEX_RCP_LOOP("vrcp14ps", "zmm", "16", EVEX_NR),
+                   VEX_RCP_LOOP("vrcp14ps", "zmm", "16", EVEX_NR EVEX_NR))
+    }
+
+    #undef RCP_KERNEL
+    #undef VEX_RCP_LOOP
+    #undef SSE_RCP_LOOP
+    #undef EVEX_NR
+    #undef VEX_NR
+    #undef SSE_NR
+    #undef CONVERT_KERNEL
+    #undef PACKED_KERNEL
+    #undef BF16_LOOP
+    #undef F16C_LOOP
+    #undef VEX_LOOP
+    #undef SSE_LOOP
+
+    template <typename T = float>
+    struct Kernels {
+        const char* Name;
+        FnT<T> add, sub, mul, div;
+    };
+
+    // Semua tier float / double yang didukung CPU ini, dari yang paling lebar
+    template <typename T = float>
+    inline std::vector<Kernels<T>> Available() {
+        std::vector<Kernels<T>> k;
+        if (Cpu::HasAVX512()) k.push_back({"AVX-512", AVX512::add, AVX512::sub, AVX512::mul, AVX512::div});
+        if (Cpu::HasAVX())    k.push_back({"AVX", AVX::add, AVX::sub, AVX::mul, AVX::div});
+        if (Cpu::HasSSE())    k.push_back({"SSE", SSE::add, SSE::sub, SSE::mul, SSE::div});
+        return k;
+    }
+
+    // Kernel storage 16-bit: F16C (IEEE half) dan BF16 (bfloat16)
+    inline std::vector<Kernels<uint16_t>> Available16() {
+        std::vector<Kernels<uint16_t>> k;
+        if (Cpu::HasF16C()) k.push_back({"F16C", F16C::add, F16C::sub, F16C::mul, F16C::div});
+        if (Cpu::HasAVX2()) k.push_back({"BF16", BF16::add, BF16::sub, BF16::mul, BF16::div});
+        return k;
+    }
+
+    // Div approx float, rdiv[s] = s langkah Newton–Raphson
+    struct ApproxKernels {
+        const char* Name;
+        Fn rdiv[3];
+    };
+
+    inline std::vector<ApproxKernels> AvailableApprox() {
+        std::vector<ApproxKernels> k;
+        if (Cpu::HasAVX512()) k.push_back({"AVX-512", {AVX512::rdiv<0>, AVX512::rdiv<1>, AVX512::rdiv<2>}});
+        if (Cpu::HasAVX())    k.push_back({"AVX", {AVX::rdiv<0>, AVX::rdiv<1>, AVX::rdiv<2>}});
+        if (Cpu::HasSSE())    k.push_back({"SSE", {SSE::rdiv<0>, SSE::rdiv<1>, SSE::rdiv<2>}});
+        return k;
+    }
+
+    // Dipilih sekali saat pertama dipakai
+    template <typename T = float>
+    inline const Kernels<T>& Best() {
+        static const Kernels<T> k = [] {
+            auto all = Available<T>();
+            return all.empty() ? Kernels<T>{"Scalar", nullptr, nullptr, nullptr, nullptr} : all.front();
+        }();
+        return k;
+    }
+
+    // API span: panjang = ukuran terkecil dari x, y, out
+    #define SPAN_OP(NAME, T, SCALAR)                                                        \
+        inline void NAME(std::span<const T> x, std::span<const T> y, std::span<T> out) {    \
+            size_t n = std::min({x.size(), y.size(), out.size()});                          \
+            if (FnT<T> f = Best<T>().NAME)                                                  \
+                f(x.data(), y.data(), out.data(), n);                                       \
+            else                                                                            \
+                tail(x.data(), y.data(), out.data(), 0, n, [](T a, T b) { return SCALAR(a, b); }); \
+        }
+
+    SPAN_OP(add, float, ModF::add)
+    SPAN_OP(sub, float, ModF::sub)
+    SPAN_OP(mul, float, ModF::mul)
+    SPAN_OP(div, float, ModF::div)
+
+    SPAN_OP(add, double, ModF::add)
+    SPAN_OP(sub, double, ModF::sub)
+    SPAN_OP(mul, double, ModF::mul)
+    SPAN_OP(div, double, ModF::div)
+
+    #undef SPAN_OP
+
+    // out = x / y approx dengan steps (0..2) langkah Newton–Raphson, tier terlebar
+    inline void rdiv(std::span<const float> x, std::span<const float> y, std::span<float> out, int steps = 1) {
+        static const std::vector<ApproxKernels> all = AvailableApprox();
+        size_t n = std::min({x.size(), y.size(), out.size()});
+        if (all.empty())
+            tail(x.data(), y.data(), out.data(), 0, n, [](float a, float b) { return ModF::div(a, b); });
+        else
+            all.front().rdiv[std::clamp(steps, 0, 2)](x.data(), y.data(), out.data(), n);
+    }
+}
+
+// X86 FMA (FMA3): a * b + c dalam 1 instruksi dan 1 pembulatan (mul + add = 2 pembulatan).
+// Angka di nama = urutan operand, Intel: 231 → dest = src2 * src3 + dest, 213 → dest = src2 * dest + src3
+// AT&T terbalik: vfmadd231ps src3, src2, dest. Semua fungsi di bawah butuh Cpu::HasFMA()
+namespace HAsm {
+    inline float fma(float a, float b, float c){
+        asm volatile(
+            "vfmadd231ss %2, %1, %0"
+            : "+x"(c)
+            : "x"(a), "x"(b)
+        );
+        return c;
+    }
+
+    inline double fma(double a, double b, double c){
+        asm volatile(
+            "vfmadd231sd %2, %1, %0"
+            : "+x"(c)
+            : "x"(a), "x"(b)
+        );
+        return c;
+    }
+
+    // o[i] = a[i] * b[i] + c[i], 8 float per ymm
+    inline void fma(const float* a, const float* b, const float* c, float* o, size_t n) {
+        size_t i = 0, body = n - n % 8;
+        if (body) {
+            asm volatile(
+                "1:\n\t"
+                "vmovups (%[c],%[i],4), %%ymm0\n\t"
+                "vmovups (%[a],%[i],4), %%ymm1\n\t"
+                "vfmadd231ps (%[b],%[i],4), %%ymm1, %%ymm0\n\t"
+                "vmovups %%ymm0, (%[o],%[i],4)\n\t"
+                "add $8, %[i]\n\t"
+                "cmp %[n], %[i]\n\t"
+                "jb 1b\n\t"
+                "vzeroupper"
+                : [i] "+r"(i)
+                : [a] "r"(a), [b] "r"(b), [c] "r"(c), [o] "r"(o), [n] "m"(body)
+                : "xmm0", "xmm1", "cc", "memory"
+            );
+        }
+        for (; i < n; i++)
+            o[i] = fma(a[i], b[i], c[i]);
+    }
+
+    // sum x[i] * y[i]. Latency FMA 4-5 cycle di 2 port: 1 akumulator = 1 FMA per ~4 cycle,
+    // jadi pakai 4 akumulator ymm independen (32 float per iterasi, muat 8 register ymm i386).
+    // Urutan penjumlahan beda dengan loop biasa, hasil bisa beda di bit terakhir
+    inline float dot(const float* x, const float* y, size_t n) {
+        size_t i = 0, body = n - n % 32;
+        float sum = 0;
+        if (body) {
+            asm volatile(
+                "vxorps %%ymm0, %%ymm0, %%ymm0\n\t"
+                "vxorps %%ymm1, %%ymm1, %%ymm1\n\t"
+                "vxorps %%ymm2, %%ymm2, %%ymm2\n\t"
+                "vxorps %%ymm3, %%ymm3, %%ymm3\n\t"
+                "1:\n\t"
+                "vmovups (%[x],%[i],4), %%ymm4\n\t"
+                "vmovups 32(%[x],%[i],4), %%ymm5\n\t"
+                "vmovups 64(%[x],%[i],4), %%ymm6\n\t"
+                "vmovups 96(%[x],%[i],4), %%ymm7\n\t"
+                "vfmadd231ps (%[y],%[i],4), %%ymm4, %%ymm0\n\t"
+                "vfmadd231ps 32(%[y],%[i],4), %%ymm5, %%ymm1\n\t"
+                "vfmadd231ps 64(%[y],%[i],4), %%ymm6, %%ymm2\n\t"
+                "vfmadd231ps 96(%[y],%[i],4), %%ymm7, %%ymm3\n\t"
+                "add $32, %[i]\n\t"
+                "cmp %[n], %[i]\n\t"
+                "jb 1b\n\t"
+                // reduksi: 4 ymm → 1 ymm → xmm → scalar
+                "vaddps %%ymm1, %%ymm0, %%ymm0\n\t"
+                "vaddps %%ymm3, %%ymm2, %%ymm2\n\t"
+                "vaddps %%ymm2, %%ymm0, %%ymm0\n\t"
+                "vextractf128 $1, %%ymm0, %%xmm1\n\t"
+                "vaddps %%xmm1, %%xmm0, %%xmm0\n\t"
+                "vmovhlps %%xmm0, %%xmm0, %%xmm1\n\t"
+                "vaddps %%xmm1, %%xmm0, %%xmm0\n\t"
+                "vmovshdup %%xmm0, %%xmm1\n\t"
+                "vaddss %%xmm1, %%xmm0, %%xmm0\n\t"
+                "vmovss %%xmm0, %[sum]\n\t"
+                "vzeroupper"
+                : [i] "+r"(i), [sum] "=m"(sum)
+                : [x] "r"(x), [y] "r"(y), [n] "m"(body)
+                : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", "cc", "memory"
+            );
+        }
+        for (; i < n; i++)
+            sum = fma(x[i], y[i], sum);
+        return sum;
+    }
+
+    // AXPY: y[i] = a * x[i] + y[i] (in-place). Tiap elemen independen, unroll 4 ymm
+    // hanya mengurangi overhead loop (add / cmp / jb per 32 float)
+    inline void axpy(float a, const float* x, float* y, size_t n) {
+        size_t i = 0, body = n - n % 32;
+        if (body) {
+            asm volatile(
+                "vbroadcastss %[a], %%ymm4\n\t"
+                "1:\n\t"
+                "vmovups (%[y],%[i],4), %%ymm0\n\t"
+                "vmovups 32(%[y],%[i],4), %%ymm1\n\t"
+                "vmovups 64(%[y],%[i],4), %%ymm2\n\t"
+                "vmovups 96(%[y],%[i],4), %%ymm3\n\t"
+                "vfmadd231ps (%[x],%[i],4), %%ymm4, %%ymm0\n\t"
+                "vfmadd231ps 32(%[x],%[i],4), %%ymm4, %%ymm1\n\t"
+                "vfmadd231ps 64(%[x],%[i],4), %%ymm4, %%ymm2\n\t"
+                "vfmadd231ps 96(%[x],%[i],4), %%ymm4, %%ymm3\n\t"
+                "vmovups %%ymm0, (%[y],%[i],4)\n\t"
+                "vmovups %%ymm1, 32(%[y],%[i],4)\n\t"
+                "vmovups %%ymm2, 64(%[y],%[i],4)\n\t"
+                "vmovups %%ymm3, 96(%[y],%[i],4)\n\t"
+                "add $32, %[i]\n\t"
+                "cmp %[n], %[i]\n\t"
+                "jb 1b\n\t"
+                "vzeroupper"
+                : [i] "+r"(i)
+                : [x] "r"(x), [y] "r"(y), [a] "m"(a), [n] "m"(body)
+                : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "cc", "memory"
+            );
+        }
+        for (; i < n; i++)
+            y[i] = fma(a, x[i], y[i]);
+    }
+
+    // Polinom c[0] + c[1] x + ... + c[k] x^k (Horner): r = c[k], lalu r = r * x + c[j] turun ke j = 0
+    inline float horner(std::span<const float> c, float x) {
+        if (c.empty())
+            return 0;
+        float r = c.back();
+        for (size_t j = c.size() - 1; j-- > 0;)
+            r = fma(r, x, c[j]);
+        return r;
+    }
+
+    // o[i] = horner(c, x[i]). Rantai Horner serial per elemen, jadi 4 rantai ymm (32 elemen)
+    // jalan bersamaan. VEX tidak punya broadcast dari memory di operand FMA, jadi koefisien
+    // di-broadcast sekali ke buffer 8 float per koefisien lalu dipakai sebagai operand memory
+    inline void horner(std::span<const float> c, const float* x, float* o, size_t n) {
+        size_t i = 0, body = n - n % 32;
+        if (body && !c.empty()) {
+            std::vector<float> cb(8 * c.size());
+            for (size_t j = 0; j < c.size(); j++)
+                std::fill_n(cb.data() + 8 * j, 8, c[j]);
+            const float* base = cb.data();
+            const float* top = base + 8 * (c.size() - 1);
+            const float* p;
+
+            asm volatile(
+                "1:\n\t"
+                "vmovups (%[x],%[i],4), %%ymm4\n\t"
+                "vmovups 32(%[x],%[i],4), %%ymm5\n\t"
+                "vmovups 64(%[x],%[i],4), %%ymm6\n\t"
+                "vmovups 96(%[x],%[i],4), %%ymm7\n\t"
+                "mov %[top], %[p]\n\t"
+                "vmovups (%[p]), %%ymm0\n\t"
+                "vmovaps %%ymm0, %%ymm1\n\t"
+                "vmovaps %%ymm0, %%ymm2\n\t"
+                "vmovaps %%ymm0, %%ymm3\n\t"
+                "2:\n\t"
+                "cmp %[base], %[p]\n\t"
+                "je 3f\n\t"
+                "sub $32, %[p]\n\t"
+                "vfmadd213ps (%[p]), %%ymm4, %%ymm0\n\t"
+                "vfmadd213ps (%[p]), %%ymm5, %%ymm1\n\t"
+                "vfmadd213ps (%[p]), %%ymm6, %%ymm2\n\t"
+                "vfmadd213ps (%[p]), %%ymm7, %%ymm3\n\t"
+                "jmp 2b\n\t"
+                "3:\n\t"
+                "vmovups %%ymm0, (%[o],%[i],4)\n\t"
+                "vmovups %%ymm1, 32(%[o],%[i],4)\n\t"
+                "vmovups %%ymm2, 64(%[o],%[i],4)\n\t"
+                "vmovups %%ymm3, 96(%[o],%[i],4)\n\t"
+                "add $32, %[i]\n\t"
+                "cmp %[n], %[i]\n\t"
+                "jb 1b\n\t"
+                "vzeroupper"
+                : [i] "+r"(i), [p] "=&r"(p)
+                : [x] "r"(x), [o] "r"(o), [base] "r"(base), [top] "m"(top), [n] "m"(body)
+                : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", "cc", "memory"
+            );
+        }
+        for (; i < n; i++)
+            o[i] = horner(c, x[i]);
+    }
+}
+
+// X86 pembagian invariant (AVX2): o[i] = x[i] / d dengan InvDiv::Divider (magic + shift).
+// 32-bit: vpmuludq / vpmuldq hanya mengalikan lane genap (32 × 32 → 64), jadi lane ganjil
+// digeser ke posisi genap, dikali terpisah, lalu 32 bit atas digabung lagi dengan vpblendd.
+// 64-bit: AVX2 tidak punya mulhi 64 × 64, dirakit dari 4 vpmuludq (seperti InvDiv::Detail::MulHi),
+// dan tidak punya vpsraq, jadi SRA = ((q ^ s) >> k) ^ s dengan s = mask tanda.
+// Jumlah shift dari memory (m128), jadi konstanta di register cukup ymm5-7 (muat 8 ymm i386)
+namespace VAsm {
+    template <typename T>
+    using DivFn = void (*)(const T* x, const InvDiv::Divider<T>& d, T* o, size_t n);
+
+    // Lane genap ymm1 × ymm7 dan lane ganjil ymm0 × ymm7 → ymm1 = 32 bit atas per lane
+    #define MULHI32(MUL)                                 \
+        MUL " %%ymm7, %%ymm0, %%ymm1\n\t"                \
+        "vpsrlq $32, %%ymm0, %%ymm2\n\t"                 \
+        MUL " %%ymm7, %%ymm2, %%ymm2\n\t"                \
+        "vpsrlq $32, %%ymm1, %%ymm1\n\t"                 \
+        "vpblendd $0xAA, %%ymm2, %%ymm1, %%ymm1\n\t"
+
+    // ymm2 = 64 bit atas dari ymm0 × ymm7 (unsigned), ymm6 = Magic >> 32
+    #define MULHI64                                      \
+        "vpmuludq %%ymm7, %%ymm0, %%ymm1\n\t"            \
+        "vpsrlq $32, %%ymm0, %%ymm2\n\t"                 \
+        "vpmuludq %%ymm7, %%ymm2, %%ymm3\n\t"            \
+        "vpmuludq %%ymm6, %%ymm2, %%ymm2\n\t"            \
+        "vpsrlq $32, %%ymm1, %%ymm1\n\t"                 \
+        "vpaddq %%ymm1, %%ymm3, %%ymm3\n\t"              \
+        "vpmuludq %%ymm6, %%ymm0, %%ymm1\n\t"            \
+        "vpsllq $32, %%ymm3, %%ymm4\n\t"                 \
+        "vpsrlq $32, %%ymm4, %%ymm4\n\t"                 \
+        "vpaddq %%ymm4, %%ymm1, %%ymm1\n\t"              \
+        "vpsrlq $32, %%ymm1, %%ymm1\n\t"                 \
+        "vpsrlq $32, %%ymm3, %%ymm3\n\t"                 \
+        "vpaddq %%ymm3, %%ymm2, %%ymm2\n\t"              \
+        "vpaddq %%ymm1, %%ymm2, %%ymm2\n\t"
+
+    #define INVDIV_LOOP(SETUP, SCALE, STEP, BODY)        \
+        asm volatile(                                    \
+            SETUP                                        \
+            "1:\n\t"                                     \
+            "vmovdqu (%[x],%[i]," SCALE "), %%ymm0\n\t"  \
+            BODY                                         \
+            "vmovdqu %%ymm0, (%[o],%[i]," SCALE ")\n\t"  \
+            "add $" STEP ", %[i]\n\t"                    \
+            "cmp %[n], %[i]\n\t"                         \
+            "jb 1b\n\t"                                  \
+            "vzeroupper"                                 \
+            : [i] "+r"(i)                                \
+            : [x] "r"(x), [o] "r"(o), [n] "m"(body), [m] "m"(d.Magic), [mh] "m"(mh), \
+              [s1] "m"(s1), [s2] "m"(s2), [sign] "m"(sign) \
+            : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", "cc", "memory" \
+        )
+
+    // q = (t + ((n - t) >> s1)) >> s2
+    #define U32_BODY                                     \
+        MULHI32("vpmuludq")                              \
+        "vpsubd %%ymm1, %%ymm0, %%ymm0\n\t"              \
+        "vpsrld %[s1], %%ymm0, %%ymm0\n\t"               \
+        "vpaddd %%ymm1, %%ymm0, %%ymm0\n\t"              \
+        "vpsrld %[s2], %%ymm0, %%ymm0\n\t"
+
+    // q0 = n + mulsh(m, n), q = ((q0 >> s2) - (n >> 31)) ^ sign - sign
+    #define I32_BODY                                     \
+        MULHI32("vpmuldq")                               \
+        "vpaddd %%ymm0, %%ymm1, %%ymm1\n\t"              \
+        "vpsrad %[s2], %%ymm1, %%ymm1\n\t"               \
+        "vpsrad $31, %%ymm0, %%ymm2\n\t"                 \
+        "vpsubd %%ymm2, %%ymm1, %%ymm1\n\t"              \
+        "vpxor %[sign], %%ymm1, %%ymm1\n\t"              \
+        "vpsubd %[sign], %%ymm1, %%ymm0\n\t"
+
+    #define U64_BODY                                     \
+        MULHI64                                          \
+        "vpsubq %%ymm2, %%ymm0, %%ymm0\n\t"              \
+        "vpsrlq %[s1], %%ymm0, %%ymm0\n\t"               \
+        "vpaddq %%ymm2, %%ymm0, %%ymm0\n\t"              \
+        "vpsrlq %[s2], %%ymm0, %%ymm0\n\t"
+
+    // mulsh = mulhu - (n < 0 ? m : 0) - (m < 0 ? n : 0), ymm5 = 0 untuk vpcmpgtq
+    #define I64_BODY                                     \
+        MULHI64                                          \
+        "vpcmpgtq %%ymm0, %%ymm5, %%ymm1\n\t"            \
+        "vpand %%ymm7, %%ymm1, %%ymm3\n\t"               \
+        "vpsubq %%ymm3, %%ymm2, %%ymm2\n\t"              \
+        "vpcmpgtq %%ymm7, %%ymm5, %%ymm3\n\t"            \
+        "vpand %%ymm0, %%ymm3, %%ymm3\n\t"               \
+        "vpsubq %%ymm3, %%ymm2, %%ymm2\n\t"              \
+        "vpaddq %%ymm0, %%ymm2, %%ymm2\n\t"              \
+        "vpcmpgtq %%ymm2, %%ymm5, %%ymm3\n\t"            \
+        "vpxor %%ymm3, %%ymm2, %%ymm2\n\t"               \
+        "vpsrlq %[s2], %%ymm2, %%ymm2\n\t"               \
+        "vpxor %%ymm3, %%ymm2, %%ymm2\n\t"               \
+        "vpsubq %%ymm1, %%ymm2, %%ymm2\n\t"              \
+        "vpxor %[sign], %%ymm2, %%ymm2\n\t"              \
+        "vpsubq %[sign], %%ymm2, %%ymm0\n\t"
+
+    #define INVDIV_KERNEL(T, LOOP)                                   \
+        inline void div(const T* x, const InvDiv::Divider<T>& d, T* o, size_t n) { \
+            using U = InvDiv::Divider<T>::U;                         \
+            constexpr size_t Width = 32 / sizeof(T);                 \
+            [[maybe_unused]] const uint64_t mh = uint64_t(d.Magic) >> 32; \
+            const uint64_t s1[2] = {d.Shift1, 0}, s2[2] = {d.Shift2, 0}; \
+            U sign[Width];                                           \
+            std::fill_n(sign, Width, d.Sign);                        \
+            size_t i = 0, body = n - n % Width;                      \
+            if (body)                                                \
+                LOOP;                                                \
+            InvDiv::div(x + body, d, o + body, n - body);            \
+        }
+
+    namespace AVX2 {
+        INVDIV_KERNEL(uint32_t, INVDIV_LOOP("vpbroadcastd %[m], %%ymm7\n\t", "4", "8", U32_BODY))
+        INVDIV_KERNEL(int32_t, INVDIV_LOOP("vpbroadcastd %[m], %%ymm7\n\t", "4", "8", I32_BODY))
+        INVDIV_KERNEL(uint64_t, INVDIV_LOOP("vpbroadcastq %[m], %%ymm7\n\t"
+                                            "vpbroadcastq %[mh], %%ymm6\n\t", "8", "4", U64_BODY))
+        INVDIV_KERNEL(int64_t, INVDIV_LOOP("vpbroadcastq %[m], %%ymm7\n\t"
+                                           "vpbroadcastq %[mh], %%ymm6\n\t"
+                                           "vpxor %%ymm5, %%ymm5, %%ymm5\n\t", "8", "4", I64_BODY))
+    }
+
+    #undef INVDIV_KERNEL
+    #undef I64_BODY
+    #undef U64_BODY
+    #undef I32_BODY
+    #undef U32_BODY
+    #undef INVDIV_LOOP
+    #undef MULHI64
+    #undef MULHI32
+
+    // Kernel terlebar yang didukung CPU ini, nullptr = scalar (InvDiv::div)
+    template <typename T>
+    inline DivFn<T> BestDiv() {
+        static const DivFn<T> f = Cpu::HasAVX2() ? DivFn<T>(AVX2::div) : nullptr;
+        return f;
+    }
+
+    // out = x / d, panjang = ukuran terkecil dari x dan out
+    template <typename T>
+    inline void div(std::span<const T> x, const InvDiv::Divider<T>& d, std::span<T> out) {
+        size_t n = std::min(x.size(), out.size());
+        if (DivFn<T> f = BestDiv<T>())
+            f(x.data(), d, out.data(), n);
+        else
+            InvDiv::div(x.data(), d, out.data(), n);
+    }
+}
+
+namespace Arith {
+    ARITH_BACKEND(AsmIntBackend, "Asm", ::Asm, int, true)
+    ARITH_BACKEND(AsmFloatBackend, "Asm", ::Asm, float, Cpu::HasSSE())
+    ARITH_BACKEND(LAsmBackend, "LAsm", ::LAsm, float, true)
+    ARITH_BACKEND(HAsmBackend, "HAsm", ::HAsm, float, Cpu::HasAVX())
+#if defined(__x86_64__)
+    ARITH_BACKEND(AsmInt64Backend, "Asm", ::Asm, int64_t, true)
+#endif
+    ARITH_BACKEND(AsmDoubleBackend, "Asm", ::Asm, double, Cpu::HasSSE())
+    ARITH_BACKEND(LAsmDoubleBackend, "LAsm", ::LAsm, double, true)
+    ARITH_BACKEND(HAsmDoubleBackend, "HAsm", ::HAsm, double, Cpu::HasAVX())
+
+#if defined(__x86_64__)
+    using ArchBackends = List<AsmIntBackend, AsmFloatBackend, LAsmBackend, HAsmBackend,
+                              AsmInt64Backend, AsmDoubleBackend, LAsmDoubleBackend, HAsmDoubleBackend>;
+#else
+    using ArchBackends = List<AsmIntBackend, AsmFloatBackend, LAsmBackend, HAsmBackend,
+                              AsmDoubleBackend, LAsmDoubleBackend, HAsmDoubleBackend>;
+#endif
+}
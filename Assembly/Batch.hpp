@@ -0,0 +1,327 @@
+// Batch.hpp — evaluasi batch: kolom pasangan (x, y) dari file → op list → backend → file
+// Streaming per blok (default 4096 baris: x, y, 1 kolom hasil ≈ 48 KB, muat L2),
+// jadi file jutaan baris tidak pernah dimuat penuh ke memory.
+//   CSV:    1 baris "x,y" per row (header / baris non-angka dilewati), output "add,mul,..."
+//   Binary: pasangan interleaved x0 y0 x1 y1 ... (int32 / int64 / float32 / float64 native endian),
+//           output row-major: hasil op[0..k) per row
+#pragma once
+
+#include "Arith.hpp"
+#include "Bench.hpp"
+
+#include <fmt/format.h>
+#include <charconv>
+#include <cstdio>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Batch {
+    enum class Format { CSV, Binary };
+    enum class OpCode { Add, Sub, Mul, Div };
+
+    constexpr const char* OpNames[] = {"add", "sub", "mul", "div"};
+
+    // "add,mul,div" → {Add, Mul, Div}
+    inline std::vector<OpCode> ParseOps(const std::string& list) {
+        std::vector<OpCode> ops;
+        size_t pos = 0;
+        while (pos <= list.size()) {
+            size_t end = std::min(list.find(',', pos), list.size());
+            std::string_view name(list.data() + pos, end - pos);
+            bool found = false;
+            for (int i = 0; i < 4; i++) {
+                if (name == OpNames[i]) {
+                    ops.push_back(OpCode(i));
+                    found = true;
+                }
+            }
+            if (!found)
+                throw std::invalid_argument(fmt::format("Unknown op '{}' (add, sub, mul, div)", name));
+            pos = end + 1;
+        }
+        return ops;
+    }
+
+    // "auto": dari ekstensi, .csv → CSV, selain itu binary
+    inline Format ParseFormat(const std::string& name, const std::string& path) {
+        if (name == "csv") return Format::CSV;
+        if (name == "bin") return Format::Binary;
+        if (name != "auto")
+            throw std::invalid_argument(fmt::format("Unknown format '{}' (auto, csv, bin)", name));
+        return path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0 ? Format::CSV : Format::Binary;
+    }
+
+    // o[i] = x[i] op y[i] untuk 1 blok
+    template <typename T>
+    using Kernel = void (*)(const T* x, const T* y, T* o, size_t n);
+
+    template <typename T>
+    struct Kernels {
+        std::string Name;
+        Kernel<T> Op[4];
+    };
+
+    // Backend skalar → kernel: 1 panggilan (asm volatile) per elemen, di-inline lewat tipe B
+    template <typename B, OpCode OP>
+    void Scalar(const typename B::Type* x, const typename B::Type* y, typename B::Type* o, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            if constexpr (OP == OpCode::Add) o[i] = B::add(x[i], y[i]);
+            if constexpr (OP == OpCode::Sub) o[i] = B::sub(x[i], y[i]);
+            if constexpr (OP == OpCode::Mul) o[i] = B::mul(x[i], y[i]);
+            if constexpr (OP == OpCode::Div) o[i] = B::div(x[i], y[i]);
+        }
+    }
+
+    // Semua backend untuk tipe T yang jalan di CPU ini: skalar dari Arith::All,
+    // plus kernel array (VAsm untuk float / double di x86, SwarC untuk int)
+    template <typename T>
+    std::vector<Kernels<T>> Available() {
+        std::vector<Kernels<T>> k;
+        Arith::ForEach(Arith::All{}, [&](auto b) {
+            using B = decltype(b);
+            if constexpr (std::is_same_v<typename B::Type, T>) {
+                if (B::Available()) {
+                    k.push_back({B::Name, {Scalar<B, OpCode::Add>, Scalar<B, OpCode::Sub>,
+                                           Scalar<B, OpCode::Mul>, Scalar<B, OpCode::Div>}});
+                }
+            }
+        });
+
+        if constexpr (std::is_same_v<T, int>) {
+            k.push_back({"SwarC", {SwarC::add, SwarC::sub, SwarC::mul, SwarC::div}});
+        } else if constexpr (std::is_floating_point_v<T>) {
+            #if defined(ARITH_X86)
+                for (const auto& v : VAsm::Available<T>())
+                    k.push_back({std::string("VAsm:") + v.Name, {v.add, v.sub, v.mul, v.div}});
+
+                // Div approx (float): "VAsm:AVX~rcp1" = add/sub/mul tier AVX + rcp dengan 1 langkah NR.
+                // Setelah tier exact, jadi "VAsm" saja tetap memilih div penuh
+                if constexpr (std::is_same_v<T, float>) {
+                    for (const auto& v : VAsm::Available()) {
+                        for (const auto& a : VAsm::AvailableApprox()) {
+                            if (std::string_view(a.Name) != v.Name)
+                                continue;
+                            for (int s = 0; s < 3; s++)
+                                k.push_back({fmt::format("VAsm:{}~rcp{}", v.Name, s), {v.add, v.sub, v.mul, a.rdiv[s]}});
+                        }
+                    }
+                }
+            #endif
+        }
+        return k;
+    }
+
+    template <typename T>
+    Kernels<T> Find(const std::string& name) {
+        auto all = Available<T>();
+        for (const auto& k : all) {
+            if (k.Name == name)
+                return k;
+        }
+        // "VAsm" saja = tier terlebar
+        for (const auto& k : all) {
+            if (k.Name.rfind(name + ":", 0) == 0)
+                return k;
+        }
+
+        std::string names;
+        for (const auto& k : all)
+            names += (names.empty() ? "" : ", ") + k.Name;
+        throw std::invalid_argument(fmt::format("Unknown backend '{}' for {} (available: {})",
+                                                name, Bench::TypeName<T>(), names));
+    }
+
+    // Baca blok berikutnya ke x, y (SoA). false kalau file habis
+    template <typename T>
+    class Reader {
+    public:
+        Reader(const std::string& path, Format format) : Fmt(format) {
+            File = std::fopen(path.c_str(), Fmt == Format::CSV ? "r" : "rb");
+            if (!File)
+                throw std::runtime_error(fmt::format("Cannot open input '{}'", path));
+        }
+
+        ~Reader() {
+            std::fclose(File);
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        bool Next(std::vector<T>& x, std::vector<T>& y, size_t max) {
+            x.clear();
+            y.clear();
+            if (Fmt == Format::Binary) {
+                Pairs.resize(2 * max);
+                size_t got = std::fread(Pairs.data(), sizeof(T), 2 * max, File);
+                if (got % 2)
+                    throw std::runtime_error("Binary input has an odd number of values");
+                for (size_t i = 0; i < got; i += 2) {
+                    x.push_back(Pairs[i]);
+                    y.push_back(Pairs[i + 1]);
+                }
+            } else {
+                char line[256];
+                while (x.size() < max && std::fgets(line, sizeof line, File)) {
+                    Line++;
+                    T a, b;
+                    if (ParseRow(line, a, b)) {
+                        x.push_back(a);
+                        y.push_back(b);
+                    } else if (Rows + x.size() > 0 && !Blank(line)) {
+                        throw std::runtime_error(fmt::format("Bad CSV row at line {}", Line));
+                    }
+                }
+            }
+            Rows += x.size();
+            return !x.empty();
+        }
+
+    private:
+        std::FILE* File;
+        Format Fmt;
+        std::vector<T> Pairs;
+        size_t Line = 0, Rows = 0;
+
+        static bool Blank(const char* s) {
+            for (; *s; s++) {
+                if (*s != ' ' && *s != '\t' && *s != '\r' && *s != '\n')
+                    return false;
+            }
+            return true;
+        }
+
+        // "x,y" (spasi boleh); header / baris kosong sebelum data dilewati
+        static bool ParseRow(const char* s, T& a, T& b) {
+            auto skip = [](const char*& p) { while (*p == ' ' || *p == '\t') p++; };
+            const char* end = s + std::char_traits<char>::length(s);
+            skip(s);
+            auto r = std::from_chars(s, end, a);
+            if (r.ec != std::errc())
+                return false;
+            s = r.ptr;
+            skip(s);
+            if (*s++ != ',')
+                return false;
+            skip(s);
+            r = std::from_chars(s, end, b);
+            if (r.ec != std::errc())
+                return false;
+            s = r.ptr;
+            return Blank(s);
+        }
+    };
+
+    template <typename T>
+    class Writer {
+    public:
+        Writer(const std::string& path, Format format, const std::vector<OpCode>& ops) : Fmt(format) {
+            File = path.empty() || path == "-" ? stdout : std::fopen(path.c_str(), Fmt == Format::CSV ? "w" : "wb");
+            if (!File)
+                throw std::runtime_error(fmt::format("Cannot open output '{}'", path));
+            if (Fmt == Format::CSV) {
+                for (size_t i = 0; i < ops.size(); i++)
+                    fmt::print(File, "{}{}", i ? "," : "", OpNames[int(ops[i])]);
+                fmt::print(File, "\n");
+            }
+        }
+
+        ~Writer() {
+            if (File != stdout)
+                std::fclose(File);
+            else
+                std::fflush(File);
+        }
+
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        // cols[k][i] = hasil op k untuk row i
+        void Write(const std::vector<std::vector<T>>& cols, size_t n) {
+            if (Fmt == Format::Binary) {
+                Rows.resize(n * cols.size());
+                for (size_t i = 0; i < n; i++) {
+                    for (size_t k = 0; k < cols.size(); k++)
+                        Rows[i * cols.size() + k] = cols[k][i];
+                }
+                if (std::fwrite(Rows.data(), sizeof(T), Rows.size(), File) != Rows.size())
+                    throw std::runtime_error("Write failed");
+                return;
+            }
+
+            fmt::memory_buffer buf;
+            for (size_t i = 0; i < n; i++) {
+                for (size_t k = 0; k < cols.size(); k++)
+                    fmt::format_to(std::back_inserter(buf), "{}{}", k ? "," : "", cols[k][i]);
+                buf.push_back('\n');
+            }
+            if (std::fwrite(buf.data(), 1, buf.size(), File) != buf.size())
+                throw std::runtime_error("Write failed");
+        }
+
+    private:
+        std::FILE* File;
+        Format Fmt;
+        std::vector<T> Rows;
+    };
+
+    struct Options {
+        std::string Input, Output, Backend = "Mod";
+        Format InFormat = Format::Binary, OutFormat = Format::Binary;
+        std::vector<OpCode> Ops = {OpCode::Add, OpCode::Sub, OpCode::Mul, OpCode::Div};
+        size_t Block = 4096;
+    };
+
+    struct Stats {
+        size_t Rows = 0, Blocks = 0;
+        double TotalNs = 0, ComputeNs = 0; // ComputeNs = hanya kernel, tanpa parse / IO
+    };
+
+    // Pipeline: baca blok → tiap op jalankan kernel ke kolom hasil → tulis blok.
+    // Kolom x / y / hasil dipakai ulang antar blok (tanpa alokasi di loop)
+    template <typename T>
+    Stats Run(const Options& o) {
+        Kernels<T> k = Find<T>(o.Backend);
+        Reader<T> in(o.Input, o.InFormat);
+        Writer<T> out(o.Output, o.OutFormat, o.Ops);
+
+        size_t block = std::max<size_t>(o.Block, 1);
+        std::vector<T> x, y;
+        std::vector<std::vector<T>> cols(o.Ops.size(), std::vector<T>(block));
+        x.reserve(block);
+        y.reserve(block);
+
+        Stats st;
+        double t0 = Bench::NowNs();
+        while (in.Next(x, y, block)) {
+            size_t n = x.size();
+
+            // Integer div: 0 dan MIN / -1 trap di idiv (SIGFPE), tolak sebelum dijalankan
+            if constexpr (std::is_integral_v<T>) {
+                for (OpCode op : o.Ops) {
+                    if (op != OpCode::Div)
+                        continue;
+                    for (size_t i = 0; i < n; i++) {
+                        if (y[i] == 0 || (x[i] == std::numeric_limits<T>::min() && y[i] == -1))
+                            throw std::runtime_error(fmt::format("Row {}: integer div {} / {} is undefined", st.Rows + i + 1, x[i], y[i]));
+                    }
+                }
+            }
+
+            double c0 = Bench::NowNs();
+            for (size_t j = 0; j < o.Ops.size(); j++)
+                k.Op[int(o.Ops[j])](x.data(), y.data(), cols[j].data(), n);
+            st.ComputeNs += Bench::NowNs() - c0;
+
+            out.Write(cols, n);
+            st.Rows += n;
+            st.Blocks++;
+        }
+        st.TotalNs = Bench::NowNs() - t0;
+        return st;
+    }
+}
@@ -0,0 +1,206 @@
+// Bench.hpp — microbenchmark harness untuk backend di Arith.hpp (driver: Arith.cpp)
+// Tiap op diukur 2 cara:
+//   tput: panggilan independen (operand sama, hasil dibuang) → throughput
+//   lat:  acc = op(acc, y), tiap panggilan menunggu hasil sebelumnya → latency
+// Waktu dari clock_gettime(CLOCK_MONOTONIC), "cycle" dari counter hardware:
+//   x86:     rdtsc (reference cycle di frekuensi nominal, bukan core cycle saat turbo)
+//   AArch64: cntvct_el0 (generic timer, frekuensi cntfrq_el0, bukan core cycle)
+//   RISC-V:  rdtime (timer; rdcycle di user mode di-trap kernel Linux baru)
+#pragma once
+
+#include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <time.h>
+
+namespace Bench {
+    inline double NowNs() {
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec * 1e9 + ts.tv_nsec;
+    }
+
+    inline uint64_t Ticks() {
+        #if defined(__x86_64__) || defined(__i386__)
+            uint32_t lo, hi;
+            asm volatile(
+                "lfence\n\t"       // tunggu instruksi sebelumnya selesai
+                "rdtsc"
+                : "=a"(lo), "=d"(hi)
+                :
+                : "memory"
+            );
+            return (uint64_t)hi << 32 | lo;
+        #elif defined(__aarch64__)
+            uint64_t v;
+            asm volatile(
+                "isb\n\t"
+                "mrs %0, cntvct_el0"
+                : "=r"(v)
+                :
+                : "memory"
+            );
+            return v;
+        #elif defined(__riscv) && __riscv_xlen == 64
+            uint64_t v;
+            asm volatile("rdtime %0" : "=r"(v) : : "memory");
+            return v;
+        #else
+            return NowNs();
+        #endif
+    }
+
+    inline const char* Counter() {
+        #if defined(__x86_64__) || defined(__i386__)
+            return "tsc";
+        #elif defined(__aarch64__)
+            return "cntvct";
+        #elif defined(__riscv) && __riscv_xlen == 64
+            return "rdtime";
+        #else
+            return "ns";
+        #endif
+    }
+
+    // Barrier tanpa instruksi: compiler harus anggap v dibaca dan diubah di sini,
+    // jadi loop tidak bisa di-hoist / di-fold, tapi v tetap di register (tanpa store)
+    template <typename T>
+    inline void DoNotOptimize(T& v) {
+        if constexpr (std::is_floating_point_v<T>) {
+            #if defined(__x86_64__) || defined(__i386__)
+                asm volatile("" : "+x"(v));
+            #elif defined(__aarch64__)
+                asm volatile("" : "+w"(v));
+            #elif defined(__riscv) && defined(__riscv_flen)
+                asm volatile("" : "+f"(v));
+            #else
+                asm volatile("" : "+m"(v));
+            #endif
+        } else {
+            asm volatile("" : "+r"(v));
+        }
+    }
+
+    // Label tipe untuk CSV / output
+    template <typename T>
+    constexpr const char* TypeName() {
+        if constexpr (std::is_same_v<T, int>) return "int";
+        else if constexpr (std::is_same_v<T, int64_t>) return "int64";
+        else if constexpr (std::is_same_v<T, uint32_t>) return "uint";
+        else if constexpr (std::is_same_v<T, uint64_t>) return "uint64";
+        else if constexpr (std::is_same_v<T, float>) return "float";
+        else if constexpr (std::is_same_v<T, double>) return "double";
+        else return "?";
+    }
+
+    struct Config {
+        uint64_t Iters = 1 << 20; // panggilan per repetisi
+        int Reps = 11;
+        int Warmup = 2;           // repetisi awal yang dibuang (cache, frekuensi)
+    };
+
+    struct Row {
+        std::string Backend, Op, Type, Mode;
+        double NsMedian, NsMin, NsStddev;
+        double CyclesPerOp; // median, dalam unit Counter()
+        int Reps;
+        uint64_t Iters;
+    };
+
+    // Jalankan body (Iters op) Warmup + Reps kali, simpan ns/op dan tick/op per repetisi
+    template <typename Body>
+    Row Measure(std::string backend, std::string op, std::string type, std::string mode,
+                const Config& cfg, Body body) {
+        std::vector<double> ns, ticks;
+        for (int r = 0; r < cfg.Warmup + cfg.Reps; r++) {
+            double t0 = NowNs();
+            uint64_t c0 = Ticks();
+            body();
+            uint64_t c1 = Ticks();
+            double t1 = NowNs();
+            if (r >= cfg.Warmup) {
+                ns.push_back((t1 - t0) / cfg.Iters);
+                ticks.push_back(double(c1 - c0) / cfg.Iters);
+            }
+        }
+
+        auto median = [](std::vector<double> v) {
+            std::sort(v.begin(), v.end());
+            size_t m = v.size() / 2;
+            return v.size() % 2 ? v[m] : (v[m - 1] + v[m]) / 2;
+        };
+        double mean = 0, var = 0;
+        for (double v : ns)
+            mean += v / ns.size();
+        for (double v : ns)
+            var += (v - mean) * (v - mean) / ns.size();
+
+        return {std::move(backend), std::move(op), std::move(type), std::move(mode),
+                median(ns), *std::min_element(ns.begin(), ns.end()), std::sqrt(var),
+                median(ticks), cfg.Reps, cfg.Iters};
+    }
+
+    // Throughput + latency untuk 1 op skalar. chainY = operand kanan di rantai latency
+    // (1 untuk div / mul float supaya nilai tidak overflow ke inf atau turun ke denormal)
+    template <typename T, typename F>
+    void Op(std::vector<Row>& rows, const std::string& backend, const std::string& op,
+            F f, T x, T y, T chainY, const Config& cfg) {
+        const char* type = TypeName<T>();
+
+        rows.push_back(Measure(backend, op, type, "tput", cfg, [&] {
+            T a = x, b = y;
+            DoNotOptimize(b); // operand kanan tidak boleh di-constant-fold
+            for (uint64_t i = 0; i < cfg.Iters; i++) {
+                DoNotOptimize(a);
+                T r = f(a, b);
+                DoNotOptimize(r);
+            }
+        }));
+
+        rows.push_back(Measure(backend, op, type, "lat", cfg, [&] {
+            T acc = x, b = chainY;
+            DoNotOptimize(b);
+            for (uint64_t i = 0; i < cfg.Iters; i++) {
+                acc = f(acc, b);
+                DoNotOptimize(acc);
+            }
+        }));
+    }
+
+    // Kernel array (packed): 1 "op" = 1 elemen, hanya throughput
+    template <typename F>
+    void Array(std::vector<Row>& rows, const std::string& backend, const std::string& op,
+               F f, size_t len, const Config& cfg, const char* type = "float") {
+        Config c = cfg;
+        uint64_t calls = std::max<uint64_t>(cfg.Iters / len, 1);
+        c.Iters = calls * len;
+        rows.push_back(Measure(backend, op, type, "tput", c, [&] {
+            for (uint64_t i = 0; i < calls; i++)
+                f();
+        }));
+    }
+
+    inline void PrintCSV(std::FILE* out, const std::vector<Row>& rows) {
+        fmt::print(out, "backend,op,type,mode,ns_per_op,ns_min,ns_stddev,cycles_per_op,ops_per_cycle,counter,reps,iters\n");
+        for (const auto& r : rows) {
+            fmt::print(out, "{},{},{},{},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{},{},{}\n",
+                       r.Backend, r.Op, r.Type, r.Mode, r.NsMedian, r.NsMin, r.NsStddev,
+                       r.CyclesPerOp, r.CyclesPerOp > 0 ? 1 / r.CyclesPerOp : 0.0, Counter(), r.Reps, r.Iters);
+        }
+    }
+}
+
+// 4 op (add/sub/mul/div) dari 1 namespace, dibungkus lambda supaya bisa di-inline
+#define BENCH_NAMESPACE(ROWS, NAME, NS, T, X, Y, CFG)                                                       \
+    do {                                                                                                    \
+        constexpr bool isFloat = std::is_floating_point_v<T>;                                               \
+        Bench::Op<T>(ROWS, NAME, "add", [](T a, T b) { return NS::add(a, b); }, X, Y, Y, CFG);              \
+        Bench::Op<T>(ROWS, NAME, "sub", [](T a, T b) { return NS::sub(a, b); }, X, Y, Y, CFG);              \
+        Bench::Op<T>(ROWS, NAME, "mul", [](T a, T b) { return NS::mul(a, b); }, X, Y, isFloat ? T(1) : Y, CFG); \
+        Bench::Op<T>(ROWS, NAME, "div", [](T a, T b) { return NS::div(a, b); }, X, Y, T(1), CFG);           \
+    } while (0)
@@ -1,41 +1,64 @@
 #include <fmt/format.h>
 #include <argparse/argparse.hpp>
+#include "Brute.hpp"
+#include "Hash.hpp"
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <thread>
 #include <vector>
 #include <atomic>
-#include <cmath>
-
-using str = std::string;
-constexpr char Charset[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-constexpr int BASE = 36;
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+#include <cstring>
+#include <deque>
 
 /* Detect OS + arch */
 #if defined(_WIN64)
 	#define SYSTEM "Windows x64"
     #include <windows.h>
 
-    uint8_t GetCPUC(){
-        SYSTEM_INFO sysinfo;
-        GetSystemInfo(&sysinfo);
-        return sysinfo.dwNumberOfProcessors;
+    // Semua processor group (GetSystemInfo hanya group sendiri, max 64)
+    unsigned int GetCPUC(){
+        DWORD count = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+        return count ? count : 1;
     }
 
 #elif defined(_WIN32)
 	#define SYSTEM "Windows x86"
     #include <windows.h>
 
-    uint8_t GetCPUC(){
-        SYSTEM_INFO sysinfo;
-        GetSystemInfo(&sysinfo);
-        return sysinfo.dwNumberOfProcessors;
+    // Semua processor group (GetSystemInfo hanya group sendiri, max 64)
+    unsigned int GetCPUC(){
+        DWORD count = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+        return count ? count : 1;
     }
 
 #elif defined(__linux__)
 	#define SYSTEM "Linux"
     #include <unistd.h>
+    #include <pthread.h>
+    #include <sched.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <poll.h>
+    #include <csignal>
 
-    uint8_t GetCPUC(){
+    unsigned int GetCPUC(){
         long numCPU = sysconf(_SC_NPROCESSORS_ONLN);
         if (numCPU < 1) {
             // Handle error or use a default of 1
@@ -48,8 +71,16 @@ constexpr int BASE = 36;
 	#define SYSTEM "MacOS"
     #include <sys/sysctl.h>
     #include <mach/mach.h>
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <poll.h>
+    #include <csignal>
 
-    int GetCPUC() {
+    unsigned int GetCPUC() {
         int count = 0;
         size_t count_len = sizeof(count);
 
@@ -80,15 +111,6 @@ constexpr int BASE = 36;
     #define CPU "POWER-PC-64"
 #endif
 
-str ToBase36(uint64_t x, int width) {
-    str out(width, '0');
-    for (int i = width - 1; i >= 0; i--) {
-        out[i] = Charset[x % BASE];
-        x /= BASE;
-    }
-    return out;
-}
-
 // Convert integer → zero padded s
 str PadNum(uint64_t x, int width) {
     auto s = fmt::format("{}", x);
@@ -98,38 +120,343 @@ str PadNum(uint64_t x, int width) {
     return s;
 }
 
-uint64_t MaxSearch(int digits) {
-    return static_cast<uint64_t>(std::pow(BASE, digits));
+std::vector<str> Split(const str& s, char sep) {
+    std::vector<str> out;
+    size_t pos = 0;
+
+    while (pos <= s.size()) {
+        size_t next = s.find(sep, pos);
+        if (next == str::npos)
+            next = s.size();
+        if (next > pos)
+            out.push_back(s.substr(pos, next - pos));
+        pos = next + 1;
+    }
+    return out;
+}
+
+/* Affinity */
+// Urutan CPU untuk worker ke-i (kosong = tidak di-pin)
+std::vector<int> CpuOrder;
+
+struct CpuInfo {
+    int Cpu;
+    int Core;    // core_id (unik per package)
+    int Package; // socket
+    int Node;    // NUMA node
+};
+
+// "0-3,8,10-11" → {0,1,2,3,8,10,11}
+std::vector<int> ParseCpuList(const str& list) {
+    std::vector<int> out;
+    for (const auto& part : Split(list, ',')) {
+        auto dash = part.find('-');
+        int lo = std::stoi(part.substr(0, dash));
+        int hi = dash == str::npos ? lo : std::stoi(part.substr(dash + 1));
+        for (int c = lo; c <= hi; c++)
+            out.push_back(c);
+    }
+    return out;
+}
+
+str ReadLine(const str& path) {
+    std::ifstream file(path);
+    str line;
+    std::getline(file, line);
+    while (!line.empty() && std::isspace((unsigned char)line.back()))
+        line.pop_back();
+    return line;
+}
+
+// Topologi dari sysfs (Linux). OS lain: 1 CPU = 1 core, 1 node
+std::vector<CpuInfo> ReadTopology() {
+    std::vector<CpuInfo> out;
+
+    #if defined(__linux__)
+        const str sys = "/sys/devices/system/";
+        str online = ReadLine(sys + "cpu/online");
+
+        if (!online.empty()) {
+            std::map<int, int> nodeOf;
+            for (int n = 0; n < 1024; n++) {
+                str list = ReadLine(fmt::format("{}node/node{}/cpulist", sys, n));
+                if (list.empty())
+                    continue;
+                for (int c : ParseCpuList(list))
+                    nodeOf[c] = n;
+            }
+
+            for (int c : ParseCpuList(online)) {
+                str topo = fmt::format("{}cpu/cpu{}/topology/", sys, c);
+                str core = ReadLine(topo + "core_id");
+                str pkg  = ReadLine(topo + "physical_package_id");
+                out.push_back({c, core.empty() ? c : std::stoi(core), pkg.empty() ? 0 : std::stoi(pkg),
+                               nodeOf.count(c) ? nodeOf[c] : 0});
+            }
+        }
+    #endif
+
+    if (out.empty()) {
+        for (unsigned int c = 0; c < GetCPUC(); c++)
+            out.push_back({(int)c, (int)c, 0, 0});
+    }
+    return out;
+}
+
+// compact: core fisik dulu (1 SMT sibling per core), node per node, baru sibling berikutnya
+// spread : sama, tapi node diselang-seling supaya worker tersebar ke semua NUMA node
+std::vector<int> PlanAffinity(const std::vector<CpuInfo>& topo, bool spread) {
+    // [node][SMT level] → list CPU, urut per core
+    std::map<int, std::vector<std::vector<int>>> byNode;
+    std::map<std::tuple<int, int, int>, int> siblings;
+
+    for (const auto& c : topo) {
+        int level = siblings[std::tuple(c.Node, c.Package, c.Core)]++;
+        auto& levels = byNode[c.Node];
+        if ((int)levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(c.Cpu);
+    }
+
+    size_t maxLevel = 0;
+    for (auto& [node, levels] : byNode)
+        maxLevel = std::max(maxLevel, levels.size());
+
+    std::vector<int> order;
+    for (size_t level = 0; level < maxLevel; level++) {
+        if (!spread) {
+            for (auto& [node, levels] : byNode) {
+                if (level < levels.size())
+                    order.insert(order.end(), levels[level].begin(), levels[level].end());
+            }
+            continue;
+        }
+
+        for (size_t i = 0;; i++) {
+            bool any = false;
+            for (auto& [node, levels] : byNode) {
+                if (level < levels.size() && i < levels[level].size()) {
+                    order.push_back(levels[level][i]);
+                    any = true;
+                }
+            }
+            if (!any)
+                break;
+        }
+    }
+    return order;
+}
+
+// Pin thread pemanggil ke CPU untuk worker ke-id
+void PinWorker(int id) {
+    if (CpuOrder.empty())
+        return;
+    int cpu = CpuOrder[id % CpuOrder.size()];
+
+    #if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    #elif defined(_WIN32)
+        // Hanya processor group 0 (max 64 CPU)
+        if (cpu < 64)
+            SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu);
+    #else
+        (void)cpu; // MacOS tidak punya API affinity yang mengikat
+    #endif
 }
 
 // Single-thread brute force
-void Single(const str& target) {
+// Semua engine return index (rank) kandidat yang match, nullopt kalau tidak ketemu
+std::optional<uint64_t> Single(const str& target) {
     const int digits = target.size();
     uint64_t maxN = MaxSearch(digits);
 
-    for (uint64_t i = 0; i < maxN; i++) {
-        if (ToBase36(i, digits) == target)
-            return;
+    Odometer odo(0, digits);
+    for (uint64_t i = 0; i < maxN; i++, odo.Next()) {
+        if (odo.Equals(target))
+            return i;
     }
+    return std::nullopt;
 }
 
+/* Early termination */
+// StopFlag: lihat Brute.hpp
+// Default: cek stop tiap 4096 kandidat (latency stop <= StopEvery kandidat per worker)
+constexpr uint64_t STOP_EVERY = 4096;
+
+// Statistik polling total semua worker (opsional, --PollStats).
+// Hanya jumlah poll: satu poll = satu load relaxed (~1 ns), timing per poll
+// akan didominasi clock_gettime. Biaya polling: bandingkan --BenchStopEvery 1,4096
+struct PollStats {
+    std::atomic<uint64_t> Polls = 0;
+};
+
+// Counter polling per worker, di-flush ke PollStats saat worker selesai
+struct PollCounter {
+    PollStats* Stats;
+    uint64_t Polls = 0;
+
+    ~PollCounter() {
+        if (Stats)
+            Stats->Polls += Polls;
+    }
+
+    template <typename Pred>
+    bool operator()(Pred stopped) {
+        if (Stats)
+            Polls++;
+        return stopped();
+    }
+};
+
+/* Telemetry */
+// Counter per worker di cache line sendiri. Hanya worker pemiliknya yang menulis
+// (load + store relaxed, bukan RMW), reporter thread hanya membaca:
+// tidak ada atomic bersama di hot path
+struct alignas(64) WorkerSlot {
+    std::atomic<uint64_t> Done = 0;
+};
+
+// Reporter thread: tiap Interval cetak rate, ETA, dan imbalance antar worker
+// (rate tercepat / rata-rata, 1.00 = rata), plus 1 baris JSON per sampel ke Stream
+struct Telemetry {
+    using Clock = std::chrono::steady_clock;
+
+    std::unique_ptr<WorkerSlot[]> Slots;
+    int        Workers;
+    uint64_t   Total;
+    double     Interval; // detik
+    std::FILE* Stream;   // jsonl, nullptr = tidak ada
+
+    std::thread Reporter;
+    std::mutex Lock;
+    std::condition_variable Cv;
+    bool Stopping = false;
+
+    Clock::time_point Start, LastT;
+    std::vector<uint64_t> Last;
+
+    Telemetry(int workers, uint64_t total, double interval, std::FILE* stream)
+        : Slots(new WorkerSlot[workers]), Workers(workers), Total(total),
+          Interval(std::max(interval, 0.01)), Stream(stream), Last(workers, 0) {}
+
+    ~Telemetry() {
+        Stop();
+    }
+
+    // Hot path: dipanggil worker `id` di batas blok / poll
+    void Add(int id, uint64_t n) {
+        auto& d = Slots[id].Done;
+        d.store(d.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    // Total kandidat semua worker (tanpa Begin pun tetap dihitung, mis. untuk benchmark)
+    uint64_t Scanned() const {
+        uint64_t n = 0;
+        for (int w = 0; w < Workers; w++)
+            n += Slots[w].Done.load(std::memory_order_relaxed);
+        return n;
+    }
+
+    void Begin() {
+        Start = LastT = Clock::now();
+        Reporter = std::thread([this] {
+            std::unique_lock lock(Lock);
+            auto period = std::chrono::duration<double>(Interval);
+            while (!Cv.wait_for(lock, period, [this] { return Stopping; }))
+                Sample();
+        });
+    }
+
+    // Stop reporter dan cetak sampel terakhir
+    void Stop() {
+        if (!Reporter.joinable())
+            return;
+        {
+            std::lock_guard lock(Lock);
+            Stopping = true;
+        }
+        Cv.notify_one();
+        Reporter.join();
+        Sample();
+    }
+
+private:
+    void Sample() {
+        auto now = Clock::now();
+        double dt = std::max(std::chrono::duration<double>(now - LastT).count(), 1e-9);
+        double t = std::chrono::duration<double>(now - Start).count();
+        LastT = now;
+
+        std::vector<double> rates(Workers);
+        uint64_t done = 0;
+        double rate = 0;
+        int slowest = 0;
+        for (int w = 0; w < Workers; w++) {
+            uint64_t d = Slots[w].Done.load(std::memory_order_relaxed);
+            rates[w] = (d - Last[w]) / dt;
+            Last[w] = d;
+            done += d;
+            rate += rates[w];
+            if (rates[w] < rates[slowest])
+                slowest = w;
+        }
+
+        double mean = rate / Workers;
+        double imbalance = mean > 0 ? *std::max_element(rates.begin(), rates.end()) / mean : 1.0;
+        double eta = rate > 0 ? (Total - std::min(done, Total)) / rate : -1;
+
+        fmt::println("[{:7.1f}s] {:6.2f}% {:9.2f} Mc/s  ETA {}  imbalance {:.2f} (slowest T{} {:.2f} Mc/s)",
+                     t, 100.0 * done / Total, rate / 1e6, eta < 0 ? str("-") : fmt::format("{:.1f}s", eta),
+                     imbalance, slowest, rates[slowest] / 1e6);
+
+        if (Stream) {
+            str workers;
+            for (int w = 0; w < Workers; w++)
+                workers += fmt::format("{}{:.0f}", w ? "," : "", rates[w]);
+            fmt::print(Stream, "{{\"t\":{:.3f},\"done\":{},\"total\":{},\"rate\":{:.0f},\"eta\":{:.3f},\"imbalance\":{:.4f},\"workers\":[{}]}}\n",
+                       t, done, Total, rate, eta, imbalance, workers);
+            std::fflush(Stream);
+        }
+    }
+};
+
 // Multi-thread brute force dengan std::thread
-void Multi(const str& target, int Threads) {
+std::optional<uint64_t> Multi(const str& target, int Threads, uint64_t StopEvery = STOP_EVERY,
+                              PollStats* stats = nullptr, Telemetry* tm = nullptr) {
     const int digits = target.size();
     uint64_t maxN = MaxSearch(digits);
 
-    std::atomic<bool> Found = false;
+    StopFlag Found;
+    uint64_t Index = 0;
     uint64_t chunk = maxN / Threads;
 
     auto worker = [&](int id) {
+        PinWorker(id);
+        PollCounter poll{stats};
         uint64_t begin = id * chunk;
         uint64_t end   = (id == Threads - 1) ? maxN : (id + 1) * chunk;
 
-        for (uint64_t i = begin; i < end && !Found.load(); i++) {
-            if (ToBase36(i, digits) == target) {
-                Found.store(true);
+        Odometer odo(begin, digits);
+        for (uint64_t i = begin; i < end;) {
+            if (poll([&] { return Found.Value.load(std::memory_order_relaxed); }))
                 return;
+
+            uint64_t stop = std::min(end, i + StopEvery);
+            uint64_t from = i;
+            for (; i < stop; i++, odo.Next()) {
+                if (odo.Equals(target)) {
+                    if (tm)
+                        tm->Add(id, i - from + 1);
+                    Index = i;
+                    Found.Value.store(true);
+                    return;
+                }
             }
+            if (tm)
+                tm->Add(id, i - from);
         }
     };
 
@@ -141,35 +468,1221 @@ void Multi(const str& target, int Threads) {
 
     for (auto& th : pool)
         th.join();
+
+    return Found.Value ? std::optional(Index) : std::nullopt;
 }
 
-// Multi-thread brute force dengan std::jthread
-void MultiJ(const str& target, int Threads) {
+// Multi-thread brute force dengan std::jthread (join otomatis saat pool keluar scope).
+// Stop lewat StopFlag yang sama dengan Multi (cache line sendiri, load relaxed), bukan
+// stop_token: stop_requested() = load acquire ke state bersama tanpa padding
+std::optional<uint64_t> MultiJ(const str& target, int Threads, uint64_t StopEvery = STOP_EVERY,
+                               PollStats* stats = nullptr, Telemetry* tm = nullptr) {
     const int digits = target.size();
     uint64_t maxN = MaxSearch(digits);
 
-    std::stop_source stop;
-    auto token = stop.get_token();
-
+    StopFlag Found;
+    uint64_t Index = 0;
     uint64_t chunk = maxN / Threads;
 
-    auto worker = [&](std::stop_token st, int id) {
+    auto worker = [&](int id) {
+        PinWorker(id);
+        PollCounter poll{stats};
         uint64_t begin = id * chunk;
         uint64_t end   = (id == Threads - 1) ? maxN : (id + 1) * chunk;
 
-        for (uint64_t i = begin; i < end && !st.stop_requested(); i++) {
-            if (ToBase36(i, digits) == target) {
-                stop.request_stop();
+        Odometer odo(begin, digits);
+        for (uint64_t i = begin; i < end;) {
+            if (poll([&] { return Found.Value.load(std::memory_order_relaxed); }))
+                return;
+
+            uint64_t last = std::min(end, i + StopEvery);
+            uint64_t from = i;
+            for (; i < last; i++, odo.Next()) {
+                if (odo.Equals(target)) {
+                    if (tm)
+                        tm->Add(id, i - from + 1);
+                    Index = i;
+                    Found.Value.store(true);
+                    return;
+                }
+            }
+            if (tm)
+                tm->Add(id, i - from);
+        }
+    };
+
+    {
+        std::vector<std::jthread> pool;
+        pool.reserve(Threads);
+
+        for (int t = 0; t < Threads; t++)
+            pool.emplace_back(worker, t);
+    }
+
+    return Found.Value ? std::optional(Index) : std::nullopt;
+}
+
+/* Checkpoint */
+// File = header + bitmap 1 bit per blok (1 = blok selesai tanpa hit).
+// Worker set bit per blok (bukan per kandidat), thread flusher msync tiap interval
+struct Checkpoint {
+    struct Header {
+        char     Magic[8];
+        uint64_t Rank;   // target (blok "selesai" hanya berlaku untuk target ini)
+        uint64_t Digits;
+        uint64_t Block;
+        uint64_t Blocks;
+        uint64_t Reserved[3]; // header 64 byte → bitmap align
+    };
+    static constexpr char MagicId[8] = {'B', 'R', 'U', 'T', 'E', 'C', 'K', '1'};
+
+    str  Path;
+    bool Resume;
+    int  Interval; // detik
+
+    uint8_t*  Base = nullptr;
+    size_t    Size = 0;
+    uint64_t* Bits = nullptr;
+    uint64_t  Blocks = 0;
+
+    #if defined(__linux__) || defined(__APPLE__)
+        int Fd = -1;
+    #else
+        std::vector<uint64_t> Heap;
+    #endif
+
+    std::thread Flusher;
+    std::mutex FlushLock;
+    std::condition_variable FlushCv;
+    bool Stopping = false;
+
+    Checkpoint(str path, bool resume, int interval)
+        : Path(std::move(path)), Resume(resume), Interval(std::max(interval, 1)) {}
+
+    ~Checkpoint() {
+        Close();
+    }
+
+    // Dipanggil engine dengan ukuran blok efektif. Throw kalau file tidak bisa dipakai
+    void Open(uint64_t rank, int digits, uint64_t block, uint64_t maxN) {
+        Blocks = (maxN + block - 1) / block;
+        Size = sizeof(Header) + (Blocks + 63) / 64 * 8;
+        Header want{};
+        std::memcpy(want.Magic, MagicId, 8);
+        want.Rank = rank;
+        want.Digits = digits;
+        want.Block = block;
+        want.Blocks = Blocks;
+
+        // Resume: header dan ukuran dicek dulu, file tidak disentuh (ftruncate / tulis) kalau tidak cocok
+        auto mismatch = [&] {
+            return std::runtime_error(fmt::format("Checkpoint '{}' does not match this target/block size", Path));
+        };
+
+        #if defined(__linux__) || defined(__APPLE__)
+            Fd = open(Path.c_str(), Resume ? O_RDWR : O_RDWR | O_CREAT, 0644);
+            if (Fd < 0)
+                throw std::runtime_error(fmt::format("Cannot open checkpoint '{}'", Path));
+
+            if (Resume) {
+                struct stat st;
+                Header have{};
+                bool match = fstat(Fd, &st) == 0 && (size_t)st.st_size == Size &&
+                             pread(Fd, &have, sizeof have, 0) == (ssize_t)sizeof have &&
+                             std::memcmp(&have, &want, sizeof have) == 0;
+                if (!match) {
+                    close(Fd);
+                    Fd = -1;
+                    throw mismatch();
+                }
+            } else if (ftruncate(Fd, Size) != 0) {
+                close(Fd);
+                Fd = -1;
+                throw std::runtime_error(fmt::format("Cannot resize checkpoint '{}'", Path));
+            }
+
+            void* map = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+            if (map == MAP_FAILED) {
+                close(Fd);
+                Fd = -1;
+                throw std::runtime_error(fmt::format("Cannot mmap checkpoint '{}'", Path));
+            }
+            Base = (uint8_t*)map;
+        #else
+            // Heap baru dipakai (dan nanti di-Sync ke file) setelah cocok
+            std::vector<uint64_t> file(Size / 8, 0);
+            if (Resume) {
+                std::ifstream in(Path, std::ios::binary);
+                bool match = in && in.read((char*)file.data(), Size) && in.gcount() == (std::streamsize)Size &&
+                             in.peek() == std::ifstream::traits_type::eof() &&
+                             std::memcmp(file.data(), &want, sizeof(Header)) == 0;
+                if (!match)
+                    throw mismatch();
+            }
+            Heap = std::move(file);
+            Base = (uint8_t*)Heap.data();
+        #endif
+
+        Bits = (uint64_t*)(Base + sizeof(Header));
+
+        if (!Resume) {
+            std::memcpy(Base, &want, sizeof(Header));
+            std::memset(Bits, 0, Size - sizeof(Header));
+        }
+        Sync();
+
+        Flusher = std::thread([this] {
+            std::unique_lock lock(FlushLock);
+            while (!FlushCv.wait_for(lock, std::chrono::seconds(Interval), [this] { return Stopping; }))
+                Sync();
+        });
+    }
+
+    bool Done(uint64_t b) const {
+        return std::atomic_ref<uint64_t>(Bits[b / 64]).load(std::memory_order_relaxed) >> (b % 64) & 1;
+    }
+
+    void Mark(uint64_t b) {
+        std::atomic_ref<uint64_t>(Bits[b / 64]).fetch_or(uint64_t(1) << (b % 64), std::memory_order_relaxed);
+    }
+
+    uint64_t Count() const {
+        uint64_t n = 0;
+        for (uint64_t w = 0; w < (Blocks + 63) / 64; w++)
+            n += std::popcount(std::atomic_ref<uint64_t>(Bits[w]).load(std::memory_order_relaxed));
+        return n;
+    }
+
+    void Sync() {
+        #if defined(__linux__) || defined(__APPLE__)
+            msync(Base, Size, MS_SYNC);
+        #else
+            std::vector<uint64_t> copy(Size / 8);
+            for (size_t w = 0; w < copy.size(); w++)
+                copy[w] = std::atomic_ref<uint64_t>(Heap[w]).load(std::memory_order_relaxed);
+
+            std::ofstream out(Path, std::ios::binary | std::ios::trunc);
+            out.write((const char*)copy.data(), Size);
+            out.flush();
+        #endif
+    }
+
+    void Close() {
+        if (!Base)
+            return;
+
+        if (Flusher.joinable()) {
+            {
+                std::lock_guard lock(FlushLock);
+                Stopping = true;
+            }
+            FlushCv.notify_one();
+            Flusher.join();
+        }
+        Sync();
+
+        #if defined(__linux__) || defined(__APPLE__)
+            munmap(Base, Size);
+            close(Fd);
+        #endif
+        Base = nullptr;
+    }
+};
+
+// Multi-thread brute force dengan shared block cursor
+// Worker ambil blok kecil (Block kandidat) dari cursor atomic sampai habis,
+// jadi thread yang lambat/ter-deschedule tidak jadi bottleneck.
+// Dengan ck: blok yang sudah selesai di-skip, blok baru di-mark setelah selesai
+std::optional<uint64_t> MultiW(const str& target, int Threads, uint64_t Block, Checkpoint* ck = nullptr,
+                               Telemetry* tm = nullptr) {
+    const int digits = target.size();
+    uint64_t maxN = MaxSearch(digits);
+
+    if (ck)
+        ck->Open(*Base36Codec::Encode(target), digits, Block, maxN);
+
+    StopFlag Found;
+    uint64_t Index = 0;
+    alignas(64) std::atomic<uint64_t> Cursor = 0;
+
+    auto worker = [&](int id) {
+        PinWorker(id);
+        Odometer odo(0, digits);
+
+        while (!Found.Value.load(std::memory_order_relaxed)) {
+            uint64_t begin = Cursor.fetch_add(Block, std::memory_order_relaxed);
+            if (begin >= maxN)
+                return;
+            uint64_t end = std::min(begin + Block, maxN);
+
+            if (ck && ck->Done(begin / Block))
+                continue;
+
+            odo.Seek(begin);
+            for (uint64_t i = begin; i < end; i++, odo.Next()) {
+                if (odo.Equals(target)) {
+                    if (tm)
+                        tm->Add(id, i - begin + 1);
+                    Index = i;
+                    Found.Value.store(true);
+                    return;
+                }
+            }
+
+            if (tm)
+                tm->Add(id, end - begin);
+            if (ck)
+                ck->Mark(begin / Block);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(Threads);
+
+    for (int t = 0; t < Threads; t++)
+        pool.emplace_back(worker, t);
+
+    for (auto& th : pool)
+        th.join();
+
+    return Found.Value ? std::optional(Index) : std::nullopt;
+}
+
+
+// Multi-thread brute force dengan SIMD batch compare + shared block cursor
+// Odometer hanya jalan di prefix (digits - 1), digit terendah di-handle kernel.
+// [From, To) membatasi ke 1 shard (harus kelipatan BASE)
+std::optional<uint64_t> MultiV(const str& target, int Threads, uint64_t Block, Checkpoint* ck = nullptr,
+                               uint64_t From = 0, uint64_t To = UINT64_MAX, Telemetry* tm = nullptr) {
+    const int digits = target.size();
+    uint64_t maxN = std::min(MaxSearch(digits), To);
+    Block = (Block + BASE - 1) / BASE * BASE; // blok selalu kelipatan 1 batch
+
+    if (ck)
+        ck->Open(*Base36Codec::Encode(target), digits, Block, MaxSearch(digits));
+
+    ScanFn scan = PickScan();
+
+    alignas(32) char Low[BASE][16] = {};
+    alignas(16) char Tgt[16] = {};
+    for (int k = 0; k < BASE; k++)
+        Low[k][digits - 1] = Charset[k];
+    std::memcpy(Tgt, target.data(), digits);
+
+    StopFlag Found;
+    uint64_t Index = 0;
+    alignas(64) std::atomic<uint64_t> Cursor = From;
+
+    auto worker = [&](int id) {
+        PinWorker(id);
+        Odometer pre(0, digits - 1);
+
+        while (!Found.Value.load(std::memory_order_relaxed)) {
+            uint64_t begin = Cursor.fetch_add(Block, std::memory_order_relaxed);
+            if (begin >= maxN)
+                return;
+            uint64_t end = std::min(begin + Block, maxN);
+
+            if (ck && ck->Done(begin / Block))
+                continue;
+
+            pre.Seek(begin / BASE);
+            for (uint64_t i = begin; i < end; i += BASE, pre.Next()) {
+                if (int k = scan(pre.Str, Tgt, &Low[0][0], BASE); k >= 0) {
+                    if (tm)
+                        tm->Add(id, i - begin + BASE);
+                    Index = i + k;
+                    Found.Value.store(true);
+                    return;
+                }
+            }
+
+            if (tm)
+                tm->Add(id, end - begin);
+            if (ck)
+                ck->Mark(begin / Block);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(Threads);
+
+    for (int t = 0; t < Threads; t++)
+        pool.emplace_back(worker, t);
+
+    for (auto& th : pool)
+        th.join();
+
+    return Found.Value ? std::optional(Index) : std::nullopt;
+}
+
+// Brute force di keyspace KeyMask saja: odometer mixed-radix di prefix,
+// posisi terakhir (charset-nya sendiri) di-handle kernel SIMD, blok dibagi lewat shared cursor
+std::optional<uint64_t> MultiK(const str& target, const KeyMask& mask, int Threads, uint64_t Block,
+                               Telemetry* tm = nullptr) {
+    const int digits = mask.Width();
+    if ((int)target.size() != digits)
+        return std::nullopt;
+
+    uint64_t maxN = mask.Size();
+    const str& last = mask.Sets.back();
+    const int n = last.size();
+    Block = (Block + n - 1) / n * n; // blok selalu kelipatan 1 batch
+
+    ScanFn scan = PickScan();
+
+    alignas(32) char Low[Alphabet::MaxBase][16] = {};
+    alignas(16) char Tgt[16] = {};
+    for (int k = 0; k < n; k++)
+        Low[k][digits - 1] = last[k];
+    std::memcpy(Tgt, target.data(), digits);
+
+    StopFlag Found;
+    uint64_t Index = 0;
+    alignas(64) std::atomic<uint64_t> Cursor = 0;
+
+    auto worker = [&](int id) {
+        PinWorker(id);
+        MaskOdometer pre(mask, 0, digits - 1);
+
+        while (!Found.Value.load(std::memory_order_relaxed)) {
+            uint64_t begin = Cursor.fetch_add(Block, std::memory_order_relaxed);
+            if (begin >= maxN)
                 return;
+            uint64_t end = std::min(begin + Block, maxN);
+
+            pre.Seek(begin / n);
+            for (uint64_t i = begin; i < end; i += n, pre.Next()) {
+                if (int k = scan(pre.Str, Tgt, &Low[0][0], n); k >= 0) {
+                    if (tm)
+                        tm->Add(id, i - begin + n);
+                    Index = i + k;
+                    Found.Value.store(true);
+                    return;
+                }
             }
+
+            if (tm)
+                tm->Add(id, end - begin);
         }
     };
 
-    std::vector<std::jthread> pool;
+    std::vector<std::thread> pool;
     pool.reserve(Threads);
 
     for (int t = 0; t < Threads; t++)
         pool.emplace_back(worker, t);
+
+    for (auto& th : pool)
+        th.join();
+
+    return Found.Value ? std::optional(Index) : std::nullopt;
+}
+
+
+/* Sharding multi-proses */
+struct Range {
+    uint64_t Begin = 0;
+    uint64_t End = UINT64_MAX;
+};
+
+// Shard statis k/n: blok dibagi rata (selisih maks 1 blok), tanpa overlap, tanpa komunikasi.
+// Batas shard selalu di batas blok, jadi checkpoint per proses tetap konsisten
+Range ShardRange(uint64_t maxN, uint64_t Block, int k, int n) {
+    Block = (Block + BASE - 1) / BASE * BASE;
+    uint64_t blocks = (maxN + Block - 1) / Block;
+    uint64_t q = blocks / n, r = blocks % n;
+    uint64_t b0 = k * q + std::min<uint64_t>(k, r);
+    uint64_t b1 = b0 + q + (uint64_t(k) < r);
+    return {b0 * Block, std::min(b1 * Block, maxN)};
+}
+
+#if defined(__linux__) || defined(__APPLE__)
+// Kirim 1 baris protokol (tanpa '\n')
+bool SendLine(int fd, const str& line) {
+    str msg = line + "\n";
+    for (size_t off = 0; off < msg.size();) {
+        ssize_t n = write(fd, msg.data() + off, msg.size() - off);
+        if (n <= 0)
+            return false;
+        off += n;
+    }
+    return true;
+}
+
+// Angka desimal dari peer: seluruh kata harus digit dan muat uint64, selain itu nullopt
+std::optional<uint64_t> ParseU64(const str& s) {
+    uint64_t v = 0;
+    auto [end, ec] = std::from_chars(s.data(), s.data() + s.size(), v);
+    if (s.empty() || ec != std::errc{} || end != s.data() + s.size())
+        return std::nullopt;
+    return v;
+}
+
+// Ambil 1 baris dari buf, baca dari fd kalau belum lengkap. nullopt = koneksi putus
+std::optional<str> RecvLine(int fd, str& buf) {
+    for (;;) {
+        if (size_t nl = buf.find('\n'); nl != str::npos) {
+            str line = buf.substr(0, nl);
+            buf.erase(0, nl + 1);
+            return line;
+        }
+        char tmp[256];
+        ssize_t n = read(fd, tmp, sizeof tmp);
+        if (n <= 0)
+            return std::nullopt;
+        buf.append(tmp, n);
+    }
+}
+
+// Koordinator: bagi range ke worker lewat Unix socket. 1 baris teks per pesan:
+//   worker → HELLO                coord → JOB <target>
+//   worker → GET                  coord → RANGE <begin> <end> | STOP
+//   worker → DONE <begin> <end>   (progress)
+//   worker → HIT <index>
+// Range milik worker yang putus di-antrikan ulang, jadi keyspace tetap tercover tanpa overlap
+int Serve(const str& path, const str& target, uint64_t Chunk) {
+    signal(SIGPIPE, SIG_IGN);
+
+    int srv = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (srv < 0 || path.size() >= sizeof addr.sun_path) {
+        fmt::println("Error: Cannot create socket '{}'", path);
+        return 1;
+    }
+    std::strcpy(addr.sun_path, path.c_str());
+    unlink(path.c_str());
+    if (bind(srv, (sockaddr*)&addr, sizeof addr) != 0 || listen(srv, 64) != 0) {
+        fmt::println("Error: Cannot listen on '{}': {}", path, std::strerror(errno));
+        close(srv);
+        return 1;
+    }
+
+    struct Client {
+        int Fd;
+        str Buf;
+        std::vector<Range> Owned; // range yang sedang dikerjakan
+    };
+
+    uint64_t maxN = MaxSearch(target.size());
+    Chunk = (std::max<uint64_t>(Chunk, 1) + BASE - 1) / BASE * BASE;
+    uint64_t next = 0, scanned = 0;
+    std::deque<Range> requeue;
+    std::vector<Client> clients;
+    std::optional<uint64_t> hit;
+
+    fmt::println("Serving {} on {} ({} candidates, chunk {})", target, path, maxN, Chunk);
+    auto start = std::chrono::steady_clock::now();
+    auto report = start;
+
+    // false = baris rusak, client diputus (range miliknya di-antrikan ulang)
+    auto handle = [&](Client& c, const str& line) {
+        auto words = Split(line, ' ');
+        if (words.empty())
+            return true;
+
+        if (words[0] == "HELLO") {
+            SendLine(c.Fd, "JOB " + target);
+        } else if (words[0] == "GET") {
+            Range r;
+            if (!hit && !requeue.empty()) {
+                r = requeue.front();
+                requeue.pop_front();
+            } else if (!hit && next < maxN) {
+                r = {next, std::min(next + Chunk, maxN)};
+                next = r.End;
+            } else {
+                SendLine(c.Fd, "STOP");
+                return true;
+            }
+            c.Owned.push_back(r);
+            SendLine(c.Fd, fmt::format("RANGE {} {}", r.Begin, r.End));
+        } else if (words[0] == "DONE" && words.size() == 3) {
+            auto begin = ParseU64(words[1]), end = ParseU64(words[2]);
+            if (!begin || !end)
+                return false;
+            // Hanya range yang memang dipegang client ini (duplikat / palsu tidak dihitung)
+            if (std::erase_if(c.Owned, [&](const Range& o) { return o.Begin == *begin && o.End == *end; }))
+                scanned += *end - *begin;
+        } else if (words[0] == "HIT" && words.size() == 2) {
+            auto index = ParseU64(words[1]);
+            if (!index)
+                return false;
+            if (std::any_of(c.Owned.begin(), c.Owned.end(), [&](const Range& o) { return o.Begin <= *index && *index < o.End; }))
+                hit = index;
+        } else {
+            return false;
+        }
+        return true;
+    };
+
+    auto busy = [&] {
+        for (const auto& c : clients) {
+            if (!c.Owned.empty())
+                return true;
+        }
+        return false;
+    };
+
+    while (!hit && (next < maxN || !requeue.empty() || busy())) {
+        std::vector<pollfd> fds{{srv, POLLIN, 0}};
+        for (const auto& c : clients)
+            fds.push_back({c.Fd, POLLIN, 0});
+        poll(fds.data(), fds.size(), 1000);
+
+        if (fds[0].revents & POLLIN) {
+            if (int fd = accept(srv, nullptr, nullptr); fd >= 0)
+                clients.push_back({fd, {}, {}});
+        }
+
+        // Dari belakang supaya erase tidak menggeser index fds
+        for (size_t i = fds.size() - 1; i >= 1; i--) {
+            if (!fds[i].revents)
+                continue;
+            Client& c = clients[i - 1];
+
+            char tmp[256];
+            ssize_t n = read(c.Fd, tmp, sizeof tmp);
+            bool ok = n > 0;
+            if (ok) {
+                c.Buf.append(tmp, n);
+                for (size_t nl; ok && (nl = c.Buf.find('\n')) != str::npos;) {
+                    str line = c.Buf.substr(0, nl);
+                    c.Buf.erase(0, nl + 1);
+                    ok = handle(c, line);
+                }
+            }
+            if (!ok) {
+                for (const auto& r : c.Owned)
+                    requeue.push_back(r);
+                close(c.Fd);
+                clients.erase(clients.begin() + (i - 1));
+            }
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - report >= std::chrono::seconds(1)) {
+            report = now;
+            fmt::println("Progress: {:.2f}% ({} workers, {} requeued)", 100.0 * scanned / maxN, clients.size(), requeue.size());
+        }
+    }
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    if (hit)
+        fmt::println("Index: {}", *hit);
+    else
+        fmt::println("Not found");
+    fmt::println("Done in {} ms", ms.count());
+
+    // Worker yang masih jalan dapat EOF dan berhenti
+    for (const auto& c : clients)
+        close(c.Fd);
+    close(srv);
+    unlink(path.c_str());
+    return 0;
+}
+
+// Worker: minta range ke koordinator dan cari dengan MultiV sampai dapat STOP / EOF
+int Work(const str& path, int Threads, uint64_t Block) {
+    signal(SIGPIPE, SIG_IGN);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (fd < 0 || path.size() >= sizeof addr.sun_path) {
+        fmt::println("Error: Cannot create socket '{}'", path);
+        return 1;
+    }
+    std::strcpy(addr.sun_path, path.c_str());
+    if (connect(fd, (sockaddr*)&addr, sizeof addr) != 0) {
+        fmt::println("Error: Cannot connect to '{}': {}", path, std::strerror(errno));
+        close(fd);
+        return 1;
+    }
+
+    str buf;
+    SendLine(fd, "HELLO");
+    auto job = RecvLine(fd, buf);
+    if (!job || !job->starts_with("JOB ") || !Base36Codec::Valid(job->substr(4))) {
+        fmt::println("Error: Bad JOB from coordinator");
+        close(fd);
+        return 1;
+    }
+    str target = job->substr(4);
+    fmt::println("Target: {}", target);
+    fmt::println("Threads: {}", Threads);
+
+    uint64_t ranges = 0, scanned = 0;
+    while (SendLine(fd, "GET")) {
+        auto line = RecvLine(fd, buf);
+        if (!line)
+            break;
+        auto words = Split(*line, ' ');
+        if (words.size() != 3 || words[0] != "RANGE")
+            break;
+        auto b = ParseU64(words[1]), e = ParseU64(words[2]);
+        if (!b || !e || *e < *b)
+            break;
+
+        uint64_t begin = *b, end = *e;
+        if (auto hit = MultiV(target, Threads, Block, nullptr, begin, end)) {
+            fmt::println("Hit: {}", *hit);
+            SendLine(fd, fmt::format("HIT {}", *hit));
+        }
+        SendLine(fd, fmt::format("DONE {} {}", begin, end));
+        ranges++;
+        scanned += end - begin;
+    }
+
+    fmt::println("Worked {} ranges ({} candidates)", ranges, scanned);
+    close(fd);
+    return 0;
+}
+#else
+int Serve(const str&, const str&, uint64_t) {
+    fmt::println("Error: --Serve needs Unix sockets (Linux / MacOS)");
+    return 1;
+}
+
+int Work(const str&, int, uint64_t) {
+    fmt::println("Error: --Connect needs Unix sockets (Linux / MacOS)");
+    return 1;
+}
+#endif
+
+
+/* Hash target */
+// Target = digest, bukan plaintext. Kandidat di-hash per batch 36 digit terendah
+// dengan prefix sama (seperti V<N>):
+//   FNV-1a:  state prefix dihitung 1x per batch, lalu 4 lane x 1 langkah per digit terendah
+//   SHA-256: 8 lane per Sha256x8, hanya word yang berisi digit terendah yang beda antar lane
+enum class HashKind { FNV1a, SHA256 };
+
+struct HashTarget {
+    HashKind  Kind;
+    uint64_t  Fnv = 0;
+    Digest256 Sha{};
+
+    static std::optional<HashTarget> Parse(const str& kind, const str& hex) {
+        HashTarget t;
+        if (kind == "fnv1a") {
+            auto b = ParseHex<8>(hex);
+            if (!b)
+                return std::nullopt;
+            t.Kind = HashKind::FNV1a;
+            for (uint8_t x : *b)
+                t.Fnv = t.Fnv << 8 | x;
+        } else if (kind == "sha256") {
+            auto b = ParseHex<32>(hex);
+            if (!b)
+                return std::nullopt;
+            t.Kind = HashKind::SHA256;
+            t.Sha = *b;
+        } else {
+            return std::nullopt;
+        }
+        return t;
+    }
+
+    // Cek 1 kandidat secara scalar (fallback dan verifikasi hit lane)
+    bool Match(const char* s, int n) const {
+        if (Kind == HashKind::FNV1a)
+            return Fnv1a64(s, n) == Fnv;
+        return Sha256(s, n) == Sha;
+    }
+};
+
+// Return digit terendah yang hash-nya match, atau -1. pre = len-1 char prefix
+using HashScanFn = int (*)(const HashTarget& t, const char* pre, int len);
+
+int ScanHashScalar(const HashTarget& t, const char* pre, int len) {
+    char buf[16];
+    std::memcpy(buf, pre, len - 1);
+
+    if (t.Kind == HashKind::FNV1a) {
+        uint64_t h0 = Fnv1a64(pre, len - 1);
+        for (int k = 0; k < BASE; k++) {
+            if (((h0 ^ (unsigned char)Charset[k]) * FNV_PRIME) == t.Fnv)
+                return k;
+        }
+        return -1;
+    }
+
+    for (int k = 0; k < BASE; k++) {
+        buf[len - 1] = Charset[k];
+        if (t.Match(buf, len))
+            return k;
+    }
+    return -1;
+}
+
+#if defined(HAS_X86_SIMD)
+TARGET_AVX2 int ScanHashAVX2(const HashTarget& t, const char* pre, int len) {
+    // Charset sebagai lane 64-bit (FNV) dan 32-bit (SHA), dipad ke kelipatan 8 lane
+    alignas(32) static const auto Chars = [] {
+        struct { uint64_t Q[40]; uint32_t D[40]; } c{};
+        for (int k = 0; k < BASE; k++)
+            c.Q[k] = c.D[k] = (unsigned char)Charset[k];
+        return c;
+    }();
+
+    if (t.Kind == HashKind::FNV1a) {
+        __m256i h0 = _mm256_set1_epi64x(Fnv1a64(pre, len - 1));
+        __m256i tgt = _mm256_set1_epi64x(t.Fnv);
+        for (int k = 0; k < BASE; k += 4) {
+            __m256i h = Fnv1aStepx4(h0, _mm256_loadu_si256((const __m256i*)(Chars.Q + k)));
+            // Lane di luar charset (padding nol di Q[36..39]) tidak boleh match
+            unsigned m = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(h, tgt)));
+            m &= BASE - k >= 4 ? 0xfu : (1u << (BASE - k)) - 1;
+            if (m)
+                return k + std::countr_zero(m);
+        }
+        return -1;
+    }
+
+    // Blok dasar: prefix + placeholder 0 di posisi digit terendah, sudah dipadding
+    uint32_t base[16];
+    char buf[16];
+    std::memcpy(buf, pre, len - 1);
+    buf[len - 1] = 0;
+    Sha256Pad(buf, len, base);
+
+    int wi = (len - 1) / 4;
+    __m128i shift = _mm_cvtsi32_si128(24 - 8 * ((len - 1) % 4));
+    uint32_t w0 = uint32_t(t.Sha[0]) << 24 | t.Sha[1] << 16 | t.Sha[2] << 8 | t.Sha[3];
+    __m256i tgt = _mm256_set1_epi32(w0);
+
+    __m256i blk[16], st[8];
+    for (int i = 0; i < 16; i++)
+        blk[i] = _mm256_set1_epi32(base[i]);
+
+    for (int k = 0; k < BASE; k += 8) {
+        __m256i c = _mm256_sll_epi32(_mm256_load_si256((const __m256i*)(Chars.D + k)), shift);
+        blk[wi] = _mm256_or_si256(_mm256_set1_epi32(base[wi]), c);
+        Sha256x8(blk, st);
+
+        // Filter word pertama digest, lalu verifikasi penuh secara scalar (jarang)
+        unsigned m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(st[0], tgt)));
+        m &= BASE - k >= 8 ? 0xffu : (1u << (BASE - k)) - 1;
+        for (; m; m &= m - 1) {
+            int kk = k + std::countr_zero(m);
+            buf[len - 1] = Charset[kk];
+            if (t.Match(buf, len))
+                return kk;
+        }
+    }
+    return -1;
+}
+#endif
+
+HashScanFn PickHashScan(const char** name) {
+    #if defined(HAS_X86_SIMD)
+        if (HasAVX2()) { *name = "AVX2 (FNV 4 lane, SHA-256 8 lane)"; return ScanHashAVX2; }
+    #endif
+    *name = "Scalar";
+    return ScanHashScalar;
+}
+
+struct HashHit {
+    str Plain;
+    uint64_t Index;
+};
+
+// Cari preimage dengan panjang 1..maxLen (pendek dulu). Tiap panjang dibagi
+// ke worker lewat shared block cursor seperti MultiV
+std::optional<HashHit> MultiH(const HashTarget& target, int maxLen, int Threads, uint64_t Block,
+                              HashScanFn scan) {
+    Block = (Block + BASE - 1) / BASE * BASE; // blok selalu kelipatan 1 batch
+
+    for (int len = 1; len <= maxLen; len++) {
+        uint64_t maxN = MaxSearch(len);
+        StopFlag Found;
+        uint64_t Index = 0;
+        alignas(64) std::atomic<uint64_t> Cursor = 0;
+
+        auto worker = [&](int id) {
+            PinWorker(id);
+            Odometer pre(0, len - 1);
+
+            while (!Found.Value.load(std::memory_order_relaxed)) {
+                uint64_t begin = Cursor.fetch_add(Block, std::memory_order_relaxed);
+                if (begin >= maxN)
+                    return;
+                uint64_t end = std::min(begin + Block, maxN);
+
+                pre.Seek(begin / BASE);
+                for (uint64_t i = begin; i < end; i += BASE, pre.Next()) {
+                    if (int k = scan(target, pre.Str, len); k >= 0) {
+                        Index = i + k;
+                        Found.Value.store(true);
+                        return;
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(Threads);
+
+        for (int t = 0; t < Threads; t++)
+            pool.emplace_back(worker, t);
+
+        for (auto& th : pool)
+            th.join();
+
+        if (Found.Value)
+            return HashHit{ToBase36(Index, len), Index};
+    }
+    return std::nullopt;
+}
+
+
+// Oracle: jawaban "zero-cost" (rank langsung dari codec), baseline untuk engine lain
+uint64_t Oracle(const str& target) {
+    return Base36Codec::Encode(target).value_or(UINT64_MAX);
+}
+
+/* Multi-target batch */
+// Open-addressing hash set untuk rank target (kapasitas 2^k, load <= 50%)
+struct TargetSet {
+    static constexpr uint64_t Empty = UINT64_MAX;
+
+    std::vector<uint64_t> Slots;
+    uint64_t Mask;
+    int Shift;
+
+    explicit TargetSet(size_t n) {
+        size_t cap = 16;
+        while (cap < n * 2)
+            cap <<= 1;
+
+        Slots.assign(cap, Empty);
+        Mask  = cap - 1;
+        Shift = 64 - std::countr_zero(cap);
+    }
+
+    // Fibonacci hashing: rank berurutan tersebar rata ke slot
+    size_t Slot(uint64_t x) const {
+        return (x * 0x9E3779B97F4A7C15ull) >> Shift;
+    }
+
+    bool Insert(uint64_t x) {
+        for (size_t i = Slot(x);; i = (i + 1) & Mask) {
+            if (Slots[i] == x) return false;
+            if (Slots[i] == Empty) {
+                Slots[i] = x;
+                return true;
+            }
+        }
+    }
+
+    bool Contains(uint64_t x) const {
+        for (size_t i = Slot(x);; i = (i + 1) & Mask) {
+            if (Slots[i] == x) return true;
+            if (Slots[i] == Empty) return false;
+        }
+    }
+};
+
+struct Hit {
+    str Target;
+    uint64_t Index;
+};
+
+// Hasil batch: Unique = target valid berbeda yang masuk TargetSet (penyebut Found)
+struct BatchResult {
+    std::vector<Hit> Hits;
+    uint64_t Unique = 0;
+    uint64_t Duplicates = 0;
+    uint64_t Skipped = 0;
+};
+
+// Banyak target sekaligus: dikelompokkan per panjang,
+// 1 sweep per panjang, tiap kandidat (rank) dicek ke TargetSet
+BatchResult Batch(const std::vector<str>& targets, int Threads, uint64_t Block) {
+    BatchResult res;
+    std::map<int, std::vector<uint64_t>> byLen;
+    for (const auto& t : targets) {
+        if (auto rank = Base36Codec::Encode(t))
+            byLen[t.size()].push_back(*rank);
+        else {
+            fmt::println("Warning: Skipping invalid target '{}'", t);
+            res.Skipped++;
+        }
+    }
+
+    auto& hits = res.Hits;
+    std::mutex hitLock;
+
+    for (auto& [digits, ranks] : byLen) {
+        uint64_t maxN = MaxSearch(digits);
+
+        TargetSet set(ranks.size());
+        int64_t unique = 0;
+        for (uint64_t r : ranks)
+            unique += set.Insert(r);
+        res.Unique += unique;
+        res.Duplicates += ranks.size() - unique;
+
+        std::atomic<int64_t> Remaining = unique;
+        alignas(64) std::atomic<uint64_t> Cursor = 0;
+
+        auto worker = [&](int id) {
+            PinWorker(id);
+            std::vector<Hit> local;
+
+            while (Remaining.load(std::memory_order_relaxed) > 0) {
+                uint64_t begin = Cursor.fetch_add(Block, std::memory_order_relaxed);
+                if (begin >= maxN)
+                    break;
+                uint64_t end = std::min(begin + Block, maxN);
+
+                for (uint64_t i = begin; i < end; i++) {
+                    if (set.Contains(i)) {
+                        local.push_back({ToBase36(i, digits), i});
+                        Remaining.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            std::lock_guard lock(hitLock);
+            hits.insert(hits.end(), local.begin(), local.end());
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(Threads);
+
+        for (int t = 0; t < Threads; t++)
+            pool.emplace_back(worker, t);
+
+        for (auto& th : pool)
+            th.join();
+    }
+
+    std::sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) {
+        return a.Target.size() != b.Target.size() ? a.Target.size() < b.Target.size() : a.Index < b.Index;
+    });
+    return res;
+}
+
+// Baca target dari file, 1 per baris (baris kosong di-skip)
+std::vector<str> ReadTargets(const str& path) {
+    std::vector<str> out;
+    std::ifstream file(path);
+    str line;
+
+    while (std::getline(file, line)) {
+        while (!line.empty() && std::isspace((unsigned char)line.back()))
+            line.pop_back();
+        if (!line.empty())
+            out.push_back(line);
+    }
+    return out;
+}
+
+// Engine single-target yang dikenal (nama = prefix --Mode)
+bool IsEngine(const str& engine) {
+    return engine == "S" || engine == "M" || engine == "MJ" || engine == "MW" || engine == "V" || engine == "A" || engine == "O";
+}
+
+// ThreadPool persistent per ukuran, dipakai ulang antar run (A<N> di main dan benchmark)
+ThreadPool& SharedPool(int threads) {
+    static std::map<int, std::unique_ptr<ThreadPool>> pools;
+    auto& pool = pools[threads];
+    if (!pool)
+        pool = std::make_unique<ThreadPool>(threads);
+    return *pool;
+}
+
+// Parameter engine selain target
+struct RunOpts {
+    int Threads = 1;
+    uint64_t Block = uint64_t(1) << 16;  // MW / V
+    uint64_t StopEvery = STOP_EVERY;     // M / MJ
+    Checkpoint* Ck = nullptr;            // MW / V
+    PollStats* Stats = nullptr;          // M / MJ
+    const Alphabet* Alpha = nullptr;     // A (nullptr = base-36)
+    const KeyMask* Mask = nullptr;       // K
+    Range Shard = {};                    // V: --Shard k/N
+    Telemetry* Tm = nullptr;             // M / MJ / MW / V / K
+    uint64_t* Scanned = nullptr;         // out: kandidat yang dicek (benchmark)
+};
+
+// Jalankan 1 engine single-target (dipakai main dan benchmark)
+std::optional<uint64_t> RunEngine(const str& engine, const str& target, const RunOpts& o) {
+    // Engine paralel menghitung lewat Telemetry; tanpa Tm dari caller pakai counter lokal tanpa reporter
+    bool counted = engine == "V" || engine == "K" || engine == "MW" ||
+                   ((engine == "M" || engine == "MJ") && (o.Threads > 1 || o.Tm));
+    if (o.Scanned) {
+        RunOpts sub = o;
+        sub.Scanned = nullptr;
+        std::optional<uint64_t> hit;
+        if (counted) {
+            std::optional<Telemetry> local;
+            if (!sub.Tm)
+                sub.Tm = &local.emplace(o.Threads, 0, 1.0, nullptr);
+            hit = RunEngine(engine, target, sub);
+            *o.Scanned = sub.Tm->Scanned();
+        } else if (engine == "A") {
+            SearchOptions so;
+            so.Block = o.Block;
+            if (o.Alpha)
+                so.Alpha = *o.Alpha;
+            SearchResult r = SearchFuture(SharedPool(o.Threads), target, std::move(so)).get();
+            hit = r.Index;
+            *o.Scanned = r.Scanned;
+        } else {
+            // O: 1 decode; S (dan M / MJ 1 thread): urut dari rank 0 sampai hit
+            hit = RunEngine(engine, target, sub);
+            *o.Scanned = engine == "O" ? 1 : hit ? *hit + 1 : MaxSearch(target.size());
+        }
+        return hit;
+    }
+
+    if (engine == "O")
+        return Oracle(target);
+    if (engine == "V")
+        return MultiV(target, o.Threads, o.Block, o.Ck, o.Shard.Begin, o.Shard.End, o.Tm);
+    if (engine == "A") {
+        SearchOptions so;
+        so.Block = o.Block;
+        if (o.Alpha)
+            so.Alpha = *o.Alpha;
+        return SearchFuture(SharedPool(o.Threads), target, std::move(so)).get().Index;
+    }
+    if (engine == "K")
+        return MultiK(target, *o.Mask, o.Threads, o.Block, o.Tm);
+    if (engine == "MW")
+        return MultiW(target, o.Threads, o.Block, o.Ck, o.Tm);
+    if (engine == "S" || (o.Threads == 1 && !o.Tm))
+        return Single(target);
+    if (engine == "MJ")
+        return MultiJ(target, o.Threads, o.StopEvery, o.Stats, o.Tm);
+    return Multi(target, o.Threads, o.StopEvery, o.Stats, o.Tm);
+}
+
+
+/* Benchmark */
+struct BenchRow {
+    str Engine;
+    uint64_t StopEvery; // 0 = tidak dipakai engine ini
+    int Threads;
+    int Digits;
+    str Pos;
+    int Reps;
+    double P50 = 0, P99 = 0; // ms
+    double Rate = 0;         // kandidat/detik (median kandidat yang benar-benar dicek / P50)
+    double Speedup = 0;      // vs thread count pertama untuk engine (dan StopEvery) yang sama
+    double Efficiency = 0;   // Speedup / (Threads / thread count pertama)
+};
+
+// Percentile nearest-rank
+double Percentile(std::vector<double> v, double p) {
+    std::sort(v.begin(), v.end());
+    size_t i = (size_t)std::ceil(p * v.size());
+    return v[std::clamp<size_t>(i, 1, v.size()) - 1];
+}
+
+// Default thread sweep: 1, 2, 4, ... < CPU, lalu CPU
+std::vector<int> DefaultThreads(int cpu) {
+    std::vector<int> out;
+    for (int t = 1; t < cpu; t *= 2)
+        out.push_back(t);
+    out.push_back(cpu);
+    return out;
+}
+
+// Sweep engine × StopEvery (M/MJ) × thread × panjang target × posisi target (awal/tengah/akhir keyspace)
+std::vector<BenchRow> Bench(const std::vector<str>& engines, const std::vector<int>& threads,
+                            const std::vector<int>& lens, const std::vector<uint64_t>& stops,
+                            int Reps, int Warmup, uint64_t Block) {
+    std::vector<BenchRow> rows;
+
+    for (int digits : lens) {
+        uint64_t maxN = MaxSearch(digits);
+        std::pair<const char*, uint64_t> positions[] = {
+            {"start", 0}, {"middle", maxN / 2}, {"end", maxN - 1}
+        };
+
+        for (auto [pos, rank] : positions) {
+            str target = ToBase36(rank, digits);
+
+            for (const auto& engine : engines) {
+                bool polls = engine == "M" || engine == "MJ";
+
+                for (uint64_t stopEvery : stops) {
+                    double baseP50 = 0;
+                    int baseThreads = 0;
+
+                    for (int T : threads) {
+                        // S dan O tidak pakai thread, cukup sekali
+                        if ((engine == "S" || engine == "O") && baseThreads)
+                            break;
+
+                        RunOpts opts{.Threads = T, .Block = Block, .StopEvery = stopEvery};
+                        uint64_t scanned = 0;
+                        opts.Scanned = &scanned;
+
+                        for (int w = 0; w < Warmup; w++)
+                            RunEngine(engine, target, opts);
+
+                        std::vector<double> times, counts;
+                        for (int r = 0; r < Reps; r++) {
+                            auto start = std::chrono::steady_clock::now();
+                            auto hit = RunEngine(engine, target, opts);
+                            auto end = std::chrono::steady_clock::now();
+                            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+                            counts.push_back(double(scanned));
+
+                            if (hit != rank)
+                                fmt::println("Warning: {} ({} threads) missed {} @ {}", engine, T, target, rank);
+                        }
+
+                        BenchRow row{.Engine = engine, .StopEvery = polls ? stopEvery : 0, .Threads = T,
+                                     .Digits = digits, .Pos = pos, .Reps = Reps};
+                        row.P50 = Percentile(times, 0.50);
+                        row.P99 = Percentile(times, 0.99);
+                        row.Rate = Percentile(counts, 0.50) / std::max(row.P50 / 1000.0, 1e-9);
+
+                        if (!baseThreads) {
+                            baseP50 = row.P50;
+                            baseThreads = T;
+                        }
+                        row.Speedup = baseP50 / std::max(row.P50, 1e-9);
+                        row.Efficiency = row.Speedup * baseThreads / T;
+                        rows.push_back(row);
+                    }
+
+                    // StopEvery hanya berpengaruh di M / MJ
+                    if (!polls)
+                        break;
+                }
+            }
+        }
+    }
+    return rows;
+}
+
+void PrintCSV(std::FILE* out, const std::vector<BenchRow>& rows) {
+    fmt::print(out, "engine,stop_every,threads,digits,position,reps,p50_ms,p99_ms,cand_per_s,speedup,efficiency\n");
+    for (const auto& r : rows) {
+        fmt::print(out, "{},{},{},{},{},{},{:.4f},{:.4f},{:.0f},{:.3f},{:.3f}\n",
+            r.Engine, r.StopEvery, r.Threads, r.Digits, r.Pos, r.Reps, r.P50, r.P99, r.Rate, r.Speedup, r.Efficiency);
+    }
+}
+
+void PrintJSON(std::FILE* out, const std::vector<BenchRow>& rows) {
+    fmt::print(out, "[\n");
+    for (size_t i = 0; i < rows.size(); i++) {
+        const auto& r = rows[i];
+        fmt::print(out,
+            "  {{\"engine\": \"{}\", \"stop_every\": {}, \"threads\": {}, \"digits\": {}, \"position\": \"{}\", \"reps\": {}, "
+            "\"p50_ms\": {:.4f}, \"p99_ms\": {:.4f}, \"cand_per_s\": {:.0f}, \"speedup\": {:.3f}, \"efficiency\": {:.3f}}}{}\n",
+            r.Engine, r.StopEvery, r.Threads, r.Digits, r.Pos, r.Reps, r.P50, r.P99, r.Rate, r.Speedup, r.Efficiency,
+            i + 1 < rows.size() ? "," : "");
+    }
+    fmt::print(out, "]\n");
 }
 
 
@@ -182,51 +1695,453 @@ int main(int argc, char** argv) {
     fmt::println("Running on {} using {} CPU ({} threads)\n", SYSTEM, CPU, cpu_count);
 
     Args.add_argument("-n", "--Num")
-        .default_value(str("AB12"))
-        .help("Target (0-9, A-Z)");
+        .default_value(std::vector<str>{"AB12"})
+        .append()
+        .help("Target (0-9, A-Z, atau --Charset untuk A<N>), bisa diulang untuk B<N>");
+
+    Args.add_argument("-f", "--File")
+        .help("File target (1 per baris) untuk B<N>");
 
     Args.add_argument("-m", "--Mode")
         .default_value(str("S"))
-        .help("S = Single | M<N> = Multi-thread | MJ<N> = Multi jthread");
+        .help("S = Single | M<N> = Multi-thread | MJ<N> = Multi jthread | MW<N> = Multi block cursor | V<N> = SIMD batch | A<N> = Library API (thread pool) | B<N> = Multi-target batch | K<N> = Keyspace dari --Mask | H<N> = Preimage dari --Hash digest | O = Oracle (rank langsung)");
+
+    Args.add_argument("-b", "--Block")
+        .default_value(uint64_t(1) << 16)
+        .scan<'u', uint64_t>()
+        .help("Candidates per block for MW<N>, V<N>, K<N>, B<N>, H<N>, A<N>, --Shard and --Connect");
+
+    Args.add_argument("--Charset")
+        .default_value(str("base36"))
+        .help("A<N>: digits | hex | HEX | lower | upper | base36 | alnum | custom:<chars>");
+
+    Args.add_argument("--Sweep")
+        .default_value(false)
+        .implicit_value(true)
+        .help("Tidak didukung: target plaintext sudah menentukan panjang, pakai H<N> --Len");
+
+    Args.add_argument("-k", "--Mask")
+        .help("K<N>: pola per posisi, mis. ?u?u?d?d?d?d (?d ?l ?u ?h ?H ?a ?A ??, [abc], char tetap)");
+
+    Args.add_argument("--Shard")
+        .help("V<N>: k/N, cari hanya shard ke-k dari N (0-based), tanpa overlap antar proses");
+
+    Args.add_argument("--Serve")
+        .help("Jadi koordinator di Unix socket ini, bagi range ke worker --Connect");
+
+    Args.add_argument("--Connect")
+        .help("V<N>: jadi worker, ambil range dari koordinator di Unix socket ini");
+
+    Args.add_argument("--Chunk")
+        .default_value(uint64_t(1) << 24)
+        .scan<'u', uint64_t>()
+        .help("--Serve: kandidat per range yang dibagikan");
+
+    Args.add_argument("--Progress")
+        .default_value(0.0)
+        .scan<'g', double>()
+        .help("Cetak rate / ETA / imbalance per worker tiap N detik (0 = mati)");
+
+    Args.add_argument("--ProgressOut")
+        .help("--Progress: tulis juga 1 sampel JSON per baris ke file ini");
+
+    Args.add_argument("--Hash")
+        .help("H<N>: fnv1a | sha256, -n berisi hex digest, cari preimage 0-9/A-Z");
+
+    Args.add_argument("--Len")
+        .default_value(6)
+        .scan<'i', int>()
+        .help("H<N>: panjang preimage maksimum (dicoba 1..Len)");
+
+    Args.add_argument("-a", "--Affinity")
+        .default_value(str("none"))
+        .help("none | compact (core fisik dulu) | spread (core fisik, diselang antar NUMA node)");
+
+    Args.add_argument("--StopEvery")
+        .default_value(STOP_EVERY)
+        .scan<'u', uint64_t>()
+        .help("M<N> / MJ<N>: cek stop tiap N kandidat (batas latency stop)");
+
+    Args.add_argument("--PollStats")
+        .default_value(false)
+        .implicit_value(true)
+        .help("M<N> / MJ<N>: hitung jumlah polling stop (biaya: --BenchStopEvery 1,4096)");
+
+    Args.add_argument("-c", "--Checkpoint")
+        .help("File checkpoint (bitmap blok selesai) untuk MW<N> / V<N>");
+
+    Args.add_argument("-r", "--Resume")
+        .default_value(false)
+        .implicit_value(true)
+        .help("Lanjutkan dari --Checkpoint, blok yang sudah selesai di-skip");
+
+    Args.add_argument("--CheckpointEvery")
+        .default_value(10)
+        .scan<'i', int>()
+        .help("Interval msync checkpoint (detik)");
+
+    Args.add_argument("--Bench")
+        .default_value(false)
+        .implicit_value(true)
+        .help("Benchmark engine × thread × panjang × posisi target");
+
+    Args.add_argument("--BenchEngines")
+        .default_value(str("S,M,MJ,MW,V"))
+        .help("Engine yang di-benchmark, dipisah koma");
+
+    Args.add_argument("--BenchThreads")
+        .help("Thread count, dipisah koma (default: 1, 2, 4, ... , CPU)");
+
+    Args.add_argument("--BenchStopEvery")
+        .default_value(str("4096"))
+        .help("StopEvery untuk M / MJ, dipisah koma (mis. 1,4096)");
+
+    Args.add_argument("--BenchLens")
+        .default_value(str("4,5"))
+        .help("Panjang target, dipisah koma");
+
+    Args.add_argument("--Reps")
+        .default_value(5)
+        .scan<'i', int>()
+        .help("Repetisi per konfigurasi");
+
+    Args.add_argument("--Warmup")
+        .default_value(1)
+        .scan<'i', int>()
+        .help("Run warmup (tidak diukur) per konfigurasi");
+
+    Args.add_argument("--Format")
+        .default_value(str("csv"))
+        .help("csv | json");
+
+    Args.add_argument("--Out")
+        .help("File output benchmark (default: stdout)");
 
     Args.parse_args(argc, argv);
 
-    str Num  = Args.get<str>("--Num");
+    auto Targets = Args.get<std::vector<str>>("--Num");
     str Mode = Args.get<str>("--Mode");
+    uint64_t Block = std::max<uint64_t>(Args.get<uint64_t>("--Block"), 1);
+    str Affinity = Args.get<str>("--Affinity");
+    uint64_t StopEvery = std::max<uint64_t>(Args.get<uint64_t>("--StopEvery"), 1);
 
-    int Threads = 1;
-    bool useJ = false;
+    if (Affinity != "none") {
+        if (Affinity != "compact" && Affinity != "spread") {
+            fmt::println("Error: Unknown affinity '{}'", Affinity);
+            return 1;
+        }
+
+        auto topo = ReadTopology();
+        CpuOrder = PlanAffinity(topo, Affinity == "spread");
+
+        std::set<std::tuple<int, int, int>> cores;
+        std::set<int> nodes;
+        for (const auto& c : topo) {
+            cores.insert(std::tuple(c.Node, c.Package, c.Core));
+            nodes.insert(c.Node);
+        }
+        fmt::println("Affinity: {} ({} CPUs, {} cores, {} NUMA nodes)\n", Affinity, topo.size(), cores.size(), nodes.size());
+    }
+
+    if (Args.get<bool>("--Bench")) {
+        auto engines = Split(Args.get<str>("--BenchEngines"), ',');
+        std::vector<int> threads, lens;
+
+        if (auto list = Args.present<str>("--BenchThreads")) {
+            for (const auto& t : Split(*list, ','))
+                threads.push_back(std::max(std::stoi(t), 1));
+        } else {
+            threads = DefaultThreads(cpu_count);
+        }
+
+        for (const auto& l : Split(Args.get<str>("--BenchLens"), ',')) {
+            int len = std::stoi(l);
+            if (len < 1 || len > Base36Codec::MaxDigits) {
+                fmt::println("Error: Length {} must be 1..{}", len, Base36Codec::MaxDigits);
+                return 1;
+            }
+            lens.push_back(len);
+        }
+
+        std::vector<uint64_t> stops;
+        for (const auto& n : Split(Args.get<str>("--BenchStopEvery"), ','))
+            stops.push_back(std::max<uint64_t>(std::stoull(n), 1));
+
+        for (const auto& e : engines) {
+            if (!IsEngine(e)) {
+                fmt::println("Error: Unknown engine '{}'", e);
+                return 1;
+            }
+        }
+
+        auto rows = Bench(engines, threads, lens, stops, std::max(Args.get<int>("--Reps"), 1),
+                          std::max(Args.get<int>("--Warmup"), 0), Block);
+
+        std::FILE* out = stdout;
+        if (auto path = Args.present<str>("--Out")) {
+            out = std::fopen(path->c_str(), "w");
+            if (!out) {
+                fmt::println("Error: Cannot open '{}'", *path);
+                return 1;
+            }
+        }
+
+        if (Args.get<str>("--Format") == "json")
+            PrintJSON(out, rows);
+        else
+            PrintCSV(out, rows);
+
+        if (out != stdout)
+            std::fclose(out);
+        return 0;
+    }
+
+    if (auto File = Args.present<str>("--File")) {
+        auto more = ReadTargets(*File);
+        if (!Args.is_used("--Num"))
+            Targets.clear();
+        Targets.insert(Targets.end(), more.begin(), more.end());
+    }
+
+    std::optional<Alphabet> Alpha;
+    std::optional<KeyMask> Mask;
+    try {
+        Alpha = Alphabet::Named(Args.get<str>("--Charset"));
+        if (auto pattern = Args.present<str>("--Mask"))
+            Mask = KeyMask::Parse(*pattern);
+    } catch (const std::exception& e) {
+        fmt::println("Error: {}", e.what());
+        return 1;
+    }
+
+    // Mode = nama engine + jumlah thread, mis. "MW8"
+    str Engine = Mode.substr(0, Mode.find_first_of("0123456789"));
+    int Threads = Engine.size() < Mode.size() ? std::stoi(Mode.substr(Engine.size())) : 1;
+
+    if (!IsEngine(Engine) && Engine != "B" && Engine != "K" && Engine != "H") {
+        fmt::println("Error: Unknown mode '{}'", Mode);
+        return 1;
+    }
+
+    // Target plaintext di-pad nol: kandidat lebih pendek tidak pernah match, sweep 1..L
+    // hanya buang waktu. Panjang tidak diketahui hanya masuk akal untuk digest (H<N>)
+    if (Args.get<bool>("--Sweep")) {
+        fmt::println("Error: --Sweep can't match a plaintext target shorter than itself, use H<N> --Hash ... --Len <L>");
+        return 1;
+    }
+
+    if (Alpha->Chars != Charset && Engine != "A") {
+        fmt::println("Error: --Charset needs A<N>");
+        return 1;
+    }
 
-    if (Mode == "S") Threads = 1;
-    else if (Mode.starts_with("MJ")) {
-        useJ = true;
-        Threads = std::stoi(Mode.substr(2));
+    if (Mask.has_value() != (Engine == "K")) {
+        fmt::println("Error: K<N> and --Mask go together");
+        return 1;
     }
-    else if (Mode.starts_with("M")) {
-        Threads = std::stoi(Mode.substr(1));
+
+    if (Args.is_used("--Hash") != (Engine == "H")) {
+        fmt::println("Error: H<N> and --Hash go together");
+        return 1;
     }
 
-    if(Threads > cpu_count){
-        fmt::println("Warning: Using {} more threads than available threads ({})\n", Threads-cpu_count, cpu_count);
-    } else if(Threads == cpu_count){
+    int cpus = int(cpu_count);
+    if(Threads > cpus){
+        fmt::println("Warning: Using {} more threads than available threads ({})\n", Threads - cpus, cpus);
+    } else if(Threads == cpus){
         fmt::println("Warning: Using all available threads\n");
     }
 
+    // Target berupa digest hex, kandidat 1..--Len char 0-9/A-Z
+    if (Engine == "H") {
+        str kind = Args.get<str>("--Hash");
+        auto target = Targets.size() == 1 ? HashTarget::Parse(kind, Targets[0]) : std::nullopt;
+        if (!target) {
+            fmt::println("Error: -n must be 1 {} hex digest (fnv1a = 16, sha256 = 64 hex chars)", kind);
+            return 1;
+        }
+
+        int len = Args.get<int>("--Len");
+        if (len < 1 || len > Base36Codec::MaxDigits) {
+            fmt::println("Error: Length {} must be 1..{}", len, Base36Codec::MaxDigits);
+            return 1;
+        }
+
+        const char* kernel;
+        HashScanFn scan = PickHashScan(&kernel);
+        fmt::println("Digest: {} ({})", Targets[0], kind);
+        fmt::println("Length: 1..{}", len);
+        fmt::println("Threads: {}", Threads);
+        fmt::println("Kernel: {}", kernel);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        auto hit = MultiH(*target, len, Threads, Block, scan);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        if (hit)
+            fmt::println("Preimage: {} (index {})", hit->Plain, hit->Index);
+        else
+            fmt::println("Not found");
+        fmt::println("Done in {} ms", ms.count());
+        return 0;
+    }
+
+    int MaxLen = Mask ? Mask->Width() : Alpha->MaxDigits();
+    for (const auto& t : Targets) {
+        if (t.empty() || (int)t.size() > MaxLen) {
+            fmt::println("Error: Target '{}' must be 1..{} chars", t, MaxLen);
+            return 1;
+        }
+    }
+    str Num = Targets.empty() ? str() : Targets[0];
+
+
+    if (auto path = Args.present<str>("--Connect")) {
+        if (Engine != "V") {
+            fmt::println("Error: --Connect needs V<N>");
+            return 1;
+        }
+        return Work(*path, Threads, Block);
+    }
+
+    if (Engine == "B") {
+        fmt::println("Targets: {}", Targets.size());
+        fmt::println("Threads: {}", Threads);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        auto res = Batch(Targets, Threads, Block);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        for (const auto& h : res.Hits)
+            fmt::println("Hit: {} @ {}", h.Target, h.Index);
+
+        if (res.Duplicates || res.Skipped)
+            fmt::println("Duplicates: {}, Skipped: {}", res.Duplicates, res.Skipped);
+        fmt::println("Found {}/{} in {} ms", res.Hits.size(), res.Unique, ms.count());
+        return 0;
+    }
+
+    if (Targets.size() != 1) {
+        fmt::println("Error: {} targets given, use B<N> for multi-target", Targets.size());
+        return 1;
+    }
+
+    if (Mask && !Mask->Encode(Num)) {
+        fmt::println("Error: Target '{}' does not match mask", Num);
+        return 1;
+    }
+
+    if (!Mask && !Alpha->Valid(Num)) {
+        fmt::println("Error: Target '{}' has chars outside charset '{}'", Num, Alpha->Chars);
+        return 1;
+    }
+
+    if (auto path = Args.present<str>("--Serve"))
+        return Serve(*path, Num, Args.get<uint64_t>("--Chunk"));
+
+    Range Shard;
+    if (auto spec = Args.present<str>("--Shard")) {
+        auto kn = Split(*spec, '/');
+        int k = kn.size() == 2 ? std::stoi(kn[0]) : -1;
+        int n = kn.size() == 2 ? std::stoi(kn[1]) : 0;
+        if (Engine != "V" || n < 1 || k < 0 || k >= n) {
+            fmt::println("Error: --Shard needs V<N> and k/N with 0 <= k < N");
+            return 1;
+        }
+        Shard = ShardRange(MaxSearch(Num.size()), Block, k, n);
+    }
+
     fmt::println("Target: {}", Num);
     fmt::println("Threads: {}", Threads);
 
+    if (Args.is_used("--Shard"))
+        fmt::println("Shard: {} [{}, {})", Args.get<str>("--Shard"), Shard.Begin, Shard.End);
+
+    if (Engine == "V") {
+        const char* kernel;
+        PickScan(&kernel);
+        fmt::println("Kernel: {}", kernel);
+    }
+
+    if (Engine == "A")
+        fmt::println("Charset: {} (base {})", Alpha->Chars, Alpha->Base());
+
+    if (Engine == "K") {
+        double full = 1;
+        for (int i = 0; i < Mask->Width(); i++)
+            full *= BASE;
+        fmt::println("Keyspace: {} ({:.3g}x smaller than {}^{})", Mask->Size(), full / Mask->Size(), BASE, Mask->Width());
+    }
+
     auto start = std::chrono::high_resolution_clock::now();
 
-    if (Threads == 1)
-        Single(Num);
-    else if (useJ)
-        MultiJ(Num, Threads);
-    else
-        Multi(Num, Threads);
+    std::unique_ptr<Checkpoint> ck;
+    if (auto path = Args.present<str>("--Checkpoint")) {
+        if (Engine != "MW" && Engine != "V") {
+            fmt::println("Error: --Checkpoint needs MW<N> or V<N>");
+            return 1;
+        }
+        ck = std::make_unique<Checkpoint>(*path, Args.get<bool>("--Resume"), Args.get<int>("--CheckpointEvery"));
+    }
+
+    std::unique_ptr<Telemetry> tm;
+    std::FILE* tmOut = nullptr;
+    if (double every = Args.get<double>("--Progress"); every > 0) {
+        if (Engine != "M" && Engine != "MJ" && Engine != "MW" && Engine != "V" && Engine != "K") {
+            fmt::println("Error: --Progress needs M<N>, MJ<N>, MW<N>, V<N> or K<N>");
+            return 1;
+        }
+        if (auto path = Args.present<str>("--ProgressOut")) {
+            tmOut = std::fopen(path->c_str(), "w");
+            if (!tmOut) {
+                fmt::println("Error: Cannot open '{}'", *path);
+                return 1;
+            }
+        }
+        uint64_t total = Mask ? Mask->Size() : Args.is_used("--Shard") ? Shard.End - Shard.Begin : MaxSearch(Num.size());
+        tm = std::make_unique<Telemetry>(Threads, total, every, tmOut);
+        tm->Begin();
+    }
+
+    PollStats stats;
+    std::optional<uint64_t> hit;
+    try {
+        hit = RunEngine(Engine, Num, {Threads, Block, StopEvery, ck.get(),
+                                  Args.get<bool>("--PollStats") ? &stats : nullptr, &*Alpha,
+                                  Mask ? &*Mask : nullptr, Shard, tm.get()});
+    } catch (const std::exception& e) {
+        fmt::println("Error: {}", e.what());
+        return 1;
+    }
+
+    if (tm) {
+        tm->Stop();
+        if (tmOut)
+            std::fclose(tmOut);
+    }
 
     auto end = std::chrono::high_resolution_clock::now();
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
 
-    fmt::println("Done in {} ms", ms.count());
+    if (hit)
+        fmt::println("Index: {}", *hit);
+    else
+        fmt::println("Not found");
+
+    if (Args.get<bool>("--PollStats"))
+        fmt::println("Polling: {} polls ({} per thread)", stats.Polls.load(), stats.Polls.load() / Threads);
+
+    if (ck) {
+        fmt::println("Checkpoint: {}/{} blocks done", ck->Count(), ck->Blocks);
+        ck->Close();
+    }
+
+    if (Engine == "O")
+        fmt::println("Done in {} ns", ns.count());
+    else
+        fmt::println("Done in {} ms", ms.count());
 }
 
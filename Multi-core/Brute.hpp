@@ -0,0 +1,765 @@
+// Brute.hpp — inti brute force sebagai library (header-only)
+// Codec, alphabet runtime, odometer, kernel SIMD, thread pool persistent, dan API async:
+//   ThreadPool pool(8);
+//   auto r = SearchFuture(pool, "AB12").get();          // std::future
+//   SearchResult r = co_await SearchAsync(pool, "AB12"); // coroutine
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+using str = std::string;
+constexpr char Charset[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+constexpr int BASE = 36;
+
+/* Detect SIMD (x86 only, dipilih saat runtime) */
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define HAS_X86_SIMD 1
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define TARGET_SSE2
+        #define TARGET_AVX2
+    #else
+        #define TARGET_SSE2 __attribute__((target("sse2")))
+        #define TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+// Base36Codec: kandidat ⇄ rank uint64 secara exact (tanpa floating point)
+// Rank = posisi kandidat di keyspace, sekaligus bentuk packed-nya
+struct Base36Codec {
+    // 36^12 < 2^64 < 36^13
+    static constexpr int MaxDigits = 12;
+
+    // char → digit, -1 kalau di luar Charset
+    static constexpr auto Table = [] {
+        std::array<int8_t, 256> t{};
+        t.fill(-1);
+        for (int i = 0; i < BASE; i++)
+            t[(unsigned char)Charset[i]] = i;
+        return t;
+    }();
+
+    static constexpr int Value(char c) {
+        return Table[(unsigned char)c];
+    }
+
+    static bool Valid(const str& s) {
+        if (s.empty() || s.size() > MaxDigits)
+            return false;
+        for (char c : s) {
+            if (Value(c) < 0)
+                return false;
+        }
+        return true;
+    }
+
+    // BASE^digits, exact untuk digits <= MaxDigits
+    static constexpr uint64_t Pow(int digits) {
+        uint64_t n = 1;
+        for (int i = 0; i < digits; i++)
+            n *= BASE;
+        return n;
+    }
+
+    static std::optional<uint64_t> Encode(const str& s) {
+        if (!Valid(s))
+            return std::nullopt;
+
+        uint64_t rank = 0;
+        for (char c : s)
+            rank = rank * BASE + Value(c);
+        return rank;
+    }
+
+    static void Decode(uint64_t rank, int width, char* out) {
+        for (int i = width - 1; i >= 0; i--) {
+            out[i] = Charset[rank % BASE];
+            rank /= BASE;
+        }
+    }
+
+    static str Decode(uint64_t rank, int width) {
+        str out(width, '0');
+        Decode(rank, width, out.data());
+        return out;
+    }
+};
+
+inline str ToBase36(uint64_t x, int width) {
+    return Base36Codec::Decode(x, width);
+}
+
+inline uint64_t MaxSearch(int digits) {
+    return Base36Codec::Pow(digits);
+}
+
+/* Alphabet runtime */
+// Charset dipilih saat runtime (hex, lower, alnum-62, custom), tapi kernel pencarian
+// tetap di-instantiate per base (lihat DispatchBase) supaya % dan / jadi multiply-shift
+struct Alphabet {
+    static constexpr int MaxBase = 128;
+
+    str Chars;
+    std::array<int8_t, 256> Table; // char → digit, -1 kalau di luar charset
+
+    // Throw std::invalid_argument kalau < 2 atau > MaxBase char, ada NUL, atau ada duplikat
+    explicit Alphabet(str chars) : Chars(std::move(chars)) {
+        if (Chars.size() < 2 || Chars.size() > MaxBase)
+            throw std::invalid_argument("Charset must have 2.." + std::to_string(MaxBase) + " chars");
+        Table.fill(-1);
+        for (int i = 0; i < Base(); i++) {
+            unsigned char c = Chars[i];
+            if (c == 0 || Table[c] >= 0)
+                throw std::invalid_argument("Charset must not contain NUL or duplicate chars");
+            Table[c] = i;
+        }
+    }
+
+    // digits | hex | HEX | lower | upper | base36 | alnum | custom:<chars>
+    static Alphabet Named(const str& name) {
+        if (name == "digits") return Alphabet("0123456789");
+        if (name == "hex")    return Alphabet("0123456789abcdef");
+        if (name == "HEX")    return Alphabet("0123456789ABCDEF");
+        if (name == "lower")  return Alphabet("abcdefghijklmnopqrstuvwxyz");
+        if (name == "upper")  return Alphabet("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        if (name == "base36") return Alphabet(Charset);
+        if (name == "alnum")  return Alphabet("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
+        if (name.starts_with("custom:"))
+            return Alphabet(name.substr(7));
+        throw std::invalid_argument("Unknown charset '" + name + "'");
+    }
+
+    static const Alphabet& Base36() {
+        static const Alphabet a(Charset);
+        return a;
+    }
+
+    int Base() const {
+        return Chars.size();
+    }
+
+    int Value(char c) const {
+        return Table[(unsigned char)c];
+    }
+
+    // Panjang maksimum: 1 lane SIMD (16) dan total keyspace 1..L masih muat di uint64
+    int MaxDigits() const {
+        uint64_t pow = 1, sum = 0;
+        int d = 0;
+        while (d < 16 && pow <= UINT64_MAX / Base() && sum + pow * Base() >= sum) {
+            pow *= Base();
+            sum += pow;
+            d++;
+        }
+        return d;
+    }
+
+    uint64_t Pow(int digits) const {
+        uint64_t n = 1;
+        for (int i = 0; i < digits; i++)
+            n *= Base();
+        return n;
+    }
+
+    bool Valid(const str& s) const {
+        if (s.empty() || (int)s.size() > MaxDigits())
+            return false;
+        for (char c : s) {
+            if (Value(c) < 0)
+                return false;
+        }
+        return true;
+    }
+
+    std::optional<uint64_t> Encode(const str& s) const {
+        if (!Valid(s))
+            return std::nullopt;
+
+        uint64_t rank = 0;
+        for (char c : s)
+            rank = rank * Base() + Value(c);
+        return rank;
+    }
+
+    str Decode(uint64_t rank, int width) const {
+        str out(width, Chars[0]);
+        for (int i = width - 1; i >= 0; i--) {
+            out[i] = Chars[rank % Base()];
+            rank /= Base();
+        }
+        return out;
+    }
+};
+
+// Base runtime → kernel dengan base compile-time untuk charset umum.
+// Charset custom lain jatuh ke B = 0 (base dibaca runtime)
+template <typename F>
+decltype(auto) DispatchBase(int base, F&& f) {
+    switch (base) {
+        case 10: return f.template operator()<10>();
+        case 16: return f.template operator()<16>();
+        case 26: return f.template operator()<26>();
+        case 36: return f.template operator()<36>();
+        case 62: return f.template operator()<62>();
+        default: return f.template operator()<0>();
+    }
+}
+
+// Odometer: buffer char ukuran tetap, di-increment in-place
+// Tanpa alokasi, tanpa rantai div/mod per kandidat (amortized 1 char write).
+// B = base compile-time, 0 = base runtime dari Alphabet
+template <int B>
+struct BasicOdometer {
+    static constexpr int MaxDigits = 16; // 16 byte = 1 lane SIMD
+
+    char        Str[MaxDigits] = {};
+    uint8_t     Dig[MaxDigits] = {};
+    int         Width;
+    const char* Chars;
+    int         Radix;
+
+    BasicOdometer(const Alphabet& a, uint64_t x, int width)
+        : Width(width), Chars(a.Chars.data()), Radix(a.Base()) {
+        Seek(x);
+    }
+
+    int Base() const {
+        if constexpr (B > 0)
+            return B;
+        else
+            return Radix;
+    }
+
+    // Set posisi awal (div/mod hanya sekali per worker)
+    void Seek(uint64_t x) {
+        for (int i = Width - 1; i >= 0; i--) {
+            Dig[i] = x % Base();
+            Str[i] = Chars[Dig[i]];
+            x /= Base();
+        }
+    }
+
+    // +1, carry hanya merambat saat digit wrap (Z -> 0)
+    void Next() {
+        for (int i = Width - 1; i >= 0; i--) {
+            if (++Dig[i] < Base()) {
+                Str[i] = Chars[Dig[i]];
+                return;
+            }
+            Dig[i] = 0;
+            Str[i] = Chars[0];
+        }
+    }
+
+    // Bandingkan dari digit terendah: digit itu yang hampir selalu beda,
+    // jadi rata-rata cukup 1 perbandingan per kandidat
+    bool Equals(const str& target) const {
+        for (int i = Width - 1; i >= 0; i--) {
+            if (Str[i] != target[i])
+                return false;
+        }
+        return true;
+    }
+};
+
+// Odometer base-36 (Charset default) untuk engine klasik
+struct Odometer : BasicOdometer<BASE> {
+    Odometer(uint64_t x, int width) : BasicOdometer(Alphabet::Base36(), x, width) {}
+};
+
+/* Mask keyspace */
+// Pola per posisi: ?d ?l ?u ?h ?H ?a (0-9A-Z) ?A (alnum) ?? ('?' literal), [abc] set custom,
+// selain itu char tetap. Mis. "?u?u?d?d?d?d" = 26^2 * 10^4 kandidat, bukan 36^6.
+// Rank mixed-radix: posisi terakhir paling cepat berubah
+struct KeyMask {
+    std::vector<str> Sets; // charset per posisi, char tetap = set 1 char
+
+    // Throw std::invalid_argument kalau pola tidak valid atau keyspace > uint64
+    static KeyMask Parse(const str& pattern) {
+        KeyMask m;
+        for (size_t i = 0; i < pattern.size(); i++) {
+            char c = pattern[i];
+            if (c == '?') {
+                if (++i >= pattern.size())
+                    throw std::invalid_argument("Mask ends with '?'");
+                switch (pattern[i]) {
+                    case 'd': m.Sets.push_back("0123456789"); break;
+                    case 'l': m.Sets.push_back("abcdefghijklmnopqrstuvwxyz"); break;
+                    case 'u': m.Sets.push_back("ABCDEFGHIJKLMNOPQRSTUVWXYZ"); break;
+                    case 'h': m.Sets.push_back("0123456789abcdef"); break;
+                    case 'H': m.Sets.push_back("0123456789ABCDEF"); break;
+                    case 'a': m.Sets.push_back(Charset); break;
+                    case 'A': m.Sets.push_back(Alphabet::Named("alnum").Chars); break;
+                    case '?': m.Sets.push_back("?"); break;
+                    default:
+                        throw std::invalid_argument(str("Unknown mask class '?") + pattern[i] + "'");
+                }
+            } else if (c == '[') {
+                size_t close = pattern.find(']', i + 1);
+                if (close == str::npos || close == i + 1)
+                    throw std::invalid_argument("Mask has empty or unclosed '['");
+                Alphabet set(pattern.substr(i + 1, close - i - 1)); // cek duplikat / ukuran
+                m.Sets.push_back(set.Chars);
+                i = close;
+            } else {
+                m.Sets.push_back(str(1, c));
+            }
+        }
+
+        if (m.Sets.empty() || m.Width() > 16)
+            throw std::invalid_argument("Mask must be 1..16 positions");
+        uint64_t n = 1;
+        for (const auto& set : m.Sets) {
+            if (n > UINT64_MAX / set.size())
+                throw std::invalid_argument("Mask keyspace does not fit in 64 bits");
+            n *= set.size();
+        }
+        return m;
+    }
+
+    int Width() const {
+        return Sets.size();
+    }
+
+    uint64_t Size() const {
+        uint64_t n = 1;
+        for (const auto& set : Sets)
+            n *= set.size();
+        return n;
+    }
+
+    std::optional<uint64_t> Encode(const str& s) const {
+        if ((int)s.size() != Width())
+            return std::nullopt;
+
+        uint64_t rank = 0;
+        for (int i = 0; i < Width(); i++) {
+            size_t d = Sets[i].find(s[i]);
+            if (d == str::npos)
+                return std::nullopt;
+            rank = rank * Sets[i].size() + d;
+        }
+        return rank;
+    }
+
+    str Decode(uint64_t rank) const {
+        str out(Width(), ' ');
+        for (int i = Width() - 1; i >= 0; i--) {
+            out[i] = Sets[i][rank % Sets[i].size()];
+            rank /= Sets[i].size();
+        }
+        return out;
+    }
+};
+
+// Odometer mixed-radix untuk KeyMask: radix dan charset per posisi,
+// posisi dengan char tetap (radix 1) ditulis sekali saat Seek dan tidak pernah berubah
+struct MaskOdometer {
+    static constexpr int MaxDigits = 16;
+
+    char        Str[MaxDigits] = {};
+    uint8_t     Dig[MaxDigits] = {};
+    uint8_t     Radix[MaxDigits] = {};
+    const char* Sets[MaxDigits] = {};
+    int         Width;
+
+    // Jalan di posisi 0..width-1 dari mask (width < mask.Width() untuk prefix)
+    MaskOdometer(const KeyMask& m, uint64_t x, int width) : Width(width) {
+        for (int i = 0; i < Width; i++) {
+            Radix[i] = m.Sets[i].size();
+            Sets[i] = m.Sets[i].data();
+        }
+        Seek(x);
+    }
+
+    void Seek(uint64_t x) {
+        for (int i = Width - 1; i >= 0; i--) {
+            Dig[i] = x % Radix[i];
+            Str[i] = Sets[i][Dig[i]];
+            x /= Radix[i];
+        }
+    }
+
+    void Next() {
+        for (int i = Width - 1; i >= 0; i--) {
+            if (++Dig[i] < Radix[i]) {
+                Str[i] = Sets[i][Dig[i]];
+                return;
+            }
+            Dig[i] = 0;
+            Str[i] = Sets[i][0];
+        }
+    }
+};
+
+// Flag stop di cache line sendiri, di-load relaxed hanya di batas blok,
+// jadi tidak ada traffic cache line bersama per kandidat
+struct alignas(64) StopFlag {
+    std::atomic<bool> Value = false;
+};
+
+/* SIMD batch compare */
+// Satu batch = n kandidat berurutan dengan prefix sama (digit terendah 0..n-1, n = base).
+// Tiap kandidat = 1 lane 16 byte: prefix | Low[k], dibandingkan packed dengan target.
+// low harus punya baris nol sampai n genap (AVX2 ambil 2 baris sekaligus).
+// Return: digit terendah yang match, atau -1
+using ScanFn = int (*)(const char* pre, const char* tgt, const char* low, int n);
+
+inline int ScanScalar(const char* pre, const char* tgt, const char* low, int n) {
+    uint64_t p[2], t[2];
+    std::memcpy(p, pre, 16);
+    std::memcpy(t, tgt, 16);
+
+    for (int k = 0; k < n; k++) {
+        uint64_t l[2];
+        std::memcpy(l, low + k * 16, 16);
+        if ((p[0] | l[0]) == t[0] && (p[1] | l[1]) == t[1])
+            return k;
+    }
+    return -1;
+}
+
+#if defined(HAS_X86_SIMD)
+// SSE2: 1 kandidat per xmm, n compare per batch.
+// Lane match = seluruh 16 byte (kandidat ^ target) nol; hasil di-OR ke akumulator,
+// jadi hanya 1 branch per batch. Index hit dicari ulang secara scalar (jarang)
+TARGET_SSE2 inline int ScanSSE2(const char* pre, const char* tgt, const char* low, int n) {
+    __m128i p = _mm_loadu_si128((const __m128i*)pre);
+    __m128i t = _mm_loadu_si128((const __m128i*)tgt);
+    __m128i z = _mm_setzero_si128();
+    __m128i acc = z;
+
+    for (int k = 0; k < n; k++) {
+        __m128i x = _mm_xor_si128(_mm_or_si128(p, _mm_load_si128((const __m128i*)(low + k * 16))), t);
+        x = _mm_or_si128(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+        x = _mm_or_si128(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1)));
+        acc = _mm_or_si128(acc, _mm_cmpeq_epi32(x, z));
+    }
+    if (_mm_movemask_epi8(acc) == 0)
+        return -1;
+    return ScanScalar(pre, tgt, low, n);
+}
+
+// AVX2: 2 kandidat per ymm, n/2 compare per batch
+TARGET_AVX2 inline int ScanAVX2(const char* pre, const char* tgt, const char* low, int n) {
+    __m256i p = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)pre));
+    __m256i t = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)tgt));
+    __m256i z = _mm256_setzero_si256();
+    __m256i acc = z;
+
+    for (int k = 0; k < n; k += 2) {
+        __m256i x = _mm256_xor_si256(_mm256_or_si256(p, _mm256_load_si256((const __m256i*)(low + k * 16))), t);
+        x = _mm256_or_si256(x, _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+        x = _mm256_or_si256(x, _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1)));
+        acc = _mm256_or_si256(acc, _mm256_cmpeq_epi32(x, z));
+    }
+    if (_mm256_testz_si256(acc, acc))
+        return -1;
+    return ScanScalar(pre, tgt, low, n);
+}
+
+inline bool HasAVX2() {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int r[4];
+        __cpuid(r, 1);
+        bool osxsave = (r[2] >> 27) & 1;
+        __cpuidex(r, 7, 0);
+        return osxsave && ((r[1] >> 5) & 1) && (_xgetbv(0) & 6) == 6;
+    #else
+        return __builtin_cpu_supports("avx2");
+    #endif
+}
+
+inline bool HasSSE2() {
+    #if defined(__x86_64__) || defined(_M_X64)
+        return true;
+    #elif defined(_MSC_VER) && !defined(__clang__)
+        int r[4];
+        __cpuid(r, 1);
+        return (r[3] >> 26) & 1;
+    #else
+        return __builtin_cpu_supports("sse2");
+    #endif
+}
+#endif
+
+// Pilih kernel terbaik yang didukung CPU
+inline ScanFn PickScan(const char** name = nullptr) {
+    const char* dummy;
+    if (!name) name = &dummy;
+
+    #if defined(HAS_X86_SIMD)
+        if (HasAVX2()) { *name = "AVX2"; return ScanAVX2; }
+        if (HasSSE2()) { *name = "SSE2"; return ScanSSE2; }
+    #endif
+    *name = "Scalar";
+    return ScanScalar;
+}
+
+/* Thread pool */
+// Thread dibuat sekali dan dipakai ulang antar pencarian,
+// jadi request pendek tidak bayar spawn/join thread
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned threads = std::thread::hardware_concurrency()) {
+        threads = std::max(threads, 1u);
+        Workers.reserve(threads);
+        for (unsigned t = 0; t < threads; t++)
+            Workers.emplace_back([this] { Loop(); });
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(Lock);
+            Stopping = true;
+        }
+        Cv.notify_all();
+        for (auto& th : Workers)
+            th.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(std::function<void()> task) {
+        {
+            std::lock_guard lock(Lock);
+            Tasks.push_back(std::move(task));
+        }
+        Cv.notify_one();
+    }
+
+    unsigned Size() const {
+        return Workers.size();
+    }
+
+private:
+    std::vector<std::thread> Workers;
+    std::deque<std::function<void()>> Tasks;
+    std::mutex Lock;
+    std::condition_variable Cv;
+    bool Stopping = false;
+
+    void Loop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(Lock);
+                Cv.wait(lock, [this] { return Stopping || !Tasks.empty(); });
+                if (Tasks.empty())
+                    return;
+                task = std::move(Tasks.front());
+                Tasks.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+
+/* Async search API */
+struct SearchOptions {
+    uint64_t Block = uint64_t(1) << 16; // kandidat per blok (dibulatkan ke kelipatan base)
+    unsigned Workers = 0;               // task paralel, 0 = ukuran pool
+
+    // Tanpa sweep panjang 1..L: target plaintext menentukan panjangnya sendiri
+    // (Tgt di-pad nol, kandidat lebih pendek tidak pernah match). Panjang tidak
+    // diketahui = target digest, lihat H<N> --Len di Brute.cpp
+    Alphabet Alpha = Alphabet::Base36();
+
+    // Dipanggil dari worker setiap 1 blok selesai: (kandidat sudah dicek, total keyspace)
+    std::function<void(uint64_t, uint64_t)> Progress;
+
+    // Cancel dicek di batas blok
+    std::stop_token Stop;
+};
+
+struct SearchResult {
+    std::optional<uint64_t> Index; // rank kandidat yang match (di dalam panjangnya)
+    int Length = 0;                // panjang kandidat yang match
+    uint64_t Scanned = 0;          // kandidat yang sudah dicek
+    bool Cancelled = false;
+};
+
+namespace Detail {
+    // 1 panjang kandidat di keyspace gabungan; blok tidak pernah melewati batas segmen
+    struct Segment {
+        int Len;
+        uint64_t Count;      // base^Len
+        uint64_t FirstBlock; // index blok global pertama
+        uint64_t Blocks;
+    };
+
+    // State 1 pencarian, dipegang bersama oleh semua task (shared_ptr).
+    // Task terakhir yang selesai memanggil Done
+    struct SearchJob {
+        SearchOptions Opts;
+        std::function<void(SearchResult)> Done;
+        uint64_t Block;
+        ScanFn Scan;
+
+        std::vector<Segment> Segs;
+        uint64_t Blocks = 0;
+        uint64_t Total = 0;
+        alignas(16) char Tgt[16] = {}; // sisa byte nol: kandidat beda panjang tidak pernah match
+
+        StopFlag Found;
+        uint64_t Index = 0;
+        int Length = 0;
+        alignas(64) std::atomic<uint64_t> Cursor = 0; // index blok global
+        alignas(64) std::atomic<uint64_t> Scanned = 0;
+        std::atomic<unsigned> Active = 0;
+
+        template <int B>
+        void RunBase() {
+            const Alphabet& a = Opts.Alpha;
+            const uint64_t base = B > 0 ? B : a.Base();
+
+            // Tabel digit terendah per worker, disusun ulang saat pindah panjang
+            alignas(32) char low[Alphabet::MaxBase][16] = {};
+            BasicOdometer<B> pre(a, 0, 0);
+            size_t seg = 0;
+            int len = 0;
+
+            while (!Found.Value.load(std::memory_order_relaxed) && !Opts.Stop.stop_requested()) {
+                uint64_t b = Cursor.fetch_add(1, std::memory_order_relaxed);
+                if (b >= Blocks)
+                    break;
+                while (b >= Segs[seg].FirstBlock + Segs[seg].Blocks)
+                    seg++; // cursor naik monoton, jadi segmen hanya maju
+                const Segment& s = Segs[seg];
+
+                if (s.Len != len) {
+                    len = s.Len;
+                    for (int k = 0; k < a.Base(); k++) {
+                        std::memset(low[k], 0, 16);
+                        low[k][len - 1] = a.Chars[k];
+                    }
+                    pre = BasicOdometer<B>(a, 0, len - 1);
+                }
+
+                uint64_t begin = (b - s.FirstBlock) * Block;
+                uint64_t end = std::min(begin + Block, s.Count);
+
+                bool hit = false;
+                uint64_t last = end; // hit: blok berhenti setelah batch yang match
+                pre.Seek(begin / base);
+                for (uint64_t i = begin; i < end; i += base, pre.Next()) {
+                    if (int k = Scan(pre.Str, Tgt, &low[0][0], base); k >= 0) {
+                        Index = i + k;
+                        Length = len;
+                        Found.Value.store(true);
+                        hit = true;
+                        last = std::min(i + base, end);
+                        break;
+                    }
+                }
+
+                uint64_t done = Scanned.fetch_add(last - begin, std::memory_order_relaxed) + (last - begin);
+                if (hit)
+                    break;
+                if (Opts.Progress)
+                    Opts.Progress(done, Total);
+            }
+        }
+
+        void Run() {
+            DispatchBase(Opts.Alpha.Base(), [this]<int B>() { RunBase<B>(); });
+
+            if (Active.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                SearchResult r;
+                if (Found.Value.load()) {
+                    r.Index = Index;
+                    r.Length = Length;
+                }
+                r.Scanned = Scanned.load();
+                r.Cancelled = !r.Index && Opts.Stop.stop_requested();
+                Done(std::move(r));
+            }
+        }
+    };
+}
+
+// Mulai pencarian di pool, return langsung. done dipanggil sekali dari thread pool.
+// Throw std::invalid_argument kalau target bukan 1..MaxDigits char dari opts.Alpha
+inline void Search(ThreadPool& pool, const str& target, SearchOptions opts,
+                   std::function<void(SearchResult)> done) {
+    const Alphabet& a = opts.Alpha;
+    if (!a.Valid(target))
+        throw std::invalid_argument("Target must be 1.." + std::to_string(a.MaxDigits()) +
+                                    " chars of charset '" + a.Chars + "'");
+
+    auto job = std::make_shared<Detail::SearchJob>();
+    int digits = target.size();
+    uint64_t base = a.Base();
+    job->Block = (std::max<uint64_t>(opts.Block, 1) + base - 1) / base * base;
+    job->Scan  = PickScan();
+    job->Done  = std::move(done);
+
+    uint64_t count = a.Pow(digits);
+    uint64_t blocks = (count + job->Block - 1) / job->Block;
+    job->Segs.push_back({digits, count, 0, blocks});
+    job->Blocks = blocks;
+    job->Total  = count;
+    std::memcpy(job->Tgt, target.data(), digits);
+    job->Opts = std::move(opts);
+
+    unsigned tasks = job->Opts.Workers ? job->Opts.Workers : pool.Size();
+    job->Active = tasks;
+    for (unsigned t = 0; t < tasks; t++)
+        pool.Submit([job] { job->Run(); });
+}
+
+inline std::future<SearchResult> SearchFuture(ThreadPool& pool, const str& target, SearchOptions opts = {}) {
+    auto promise = std::make_shared<std::promise<SearchResult>>();
+    auto future = promise->get_future();
+    Search(pool, target, std::move(opts), [promise](SearchResult r) { promise->set_value(std::move(r)); });
+    return future;
+}
+
+// co_await SearchAsync(pool, target): coroutine dilanjutkan di thread pool saat selesai
+struct SearchAwaiter {
+    ThreadPool& Pool;
+    str Target;
+    SearchOptions Opts;
+    SearchResult Result;
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> h) {
+        Search(Pool, Target, std::move(Opts), [this, h](SearchResult r) {
+            Result = std::move(r);
+            h.resume();
+        });
+    }
+
+    SearchResult await_resume() {
+        return std::move(Result);
+    }
+};
+
+inline SearchAwaiter SearchAsync(ThreadPool& pool, str target, SearchOptions opts = {}) {
+    return {pool, std::move(target), std::move(opts), {}};
+}
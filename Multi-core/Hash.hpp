@@ -0,0 +1,208 @@
+// Hash.hpp — hash untuk mode target digest (H<N>)
+// FNV-1a 64-bit dan SHA-256 scalar, plus SHA-256 8 lane AVX2 (1 blok per lane)
+#pragma once
+
+#include "Brute.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+/* FNV-1a 64 */
+constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ull;
+constexpr uint64_t FNV_PRIME  = 0x100000001b3ull;
+
+// h = state awal, jadi hash prefix bisa dipakai ulang untuk banyak suffix
+constexpr uint64_t Fnv1a64(const char* p, size_t n, uint64_t h = FNV_OFFSET) {
+    for (size_t i = 0; i < n; i++) {
+        h ^= (unsigned char)p[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+/* SHA-256 */
+using Digest256 = std::array<uint8_t, 32>;
+
+namespace Sha256Const {
+    constexpr uint32_t K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+    };
+
+    constexpr uint32_t H0[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+}
+
+// 1 blok 64 byte (16 word big-endian sudah di-decode) ke state
+inline void Sha256Block(uint32_t state[8], const uint32_t block[16]) {
+    using namespace Sha256Const;
+    auto rotr = [](uint32_t x, int n) { return (x >> n) | (x << (32 - n)); };
+
+    uint32_t w[64];
+    std::memcpy(w, block, 64);
+    for (int t = 16; t < 64; t++) {
+        uint32_t s0 = rotr(w[t - 15], 7) ^ rotr(w[t - 15], 18) ^ (w[t - 15] >> 3);
+        uint32_t s1 = rotr(w[t - 2], 17) ^ rotr(w[t - 2], 19) ^ (w[t - 2] >> 10);
+        w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int t = 0; t < 64; t++) {
+        uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + K[t] + w[t];
+        uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+// Pesan ≤ 55 byte → 1 blok berpadding (0x80, nol, panjang bit big-endian)
+inline void Sha256Pad(const char* p, size_t n, uint32_t block[16]) {
+    uint8_t buf[64] = {};
+    std::memcpy(buf, p, n);
+    buf[n] = 0x80;
+    uint64_t bits = n * 8;
+    for (int i = 0; i < 8; i++)
+        buf[63 - i] = bits >> (8 * i);
+    for (int i = 0; i < 16; i++)
+        block[i] = uint32_t(buf[4 * i]) << 24 | buf[4 * i + 1] << 16 | buf[4 * i + 2] << 8 | buf[4 * i + 3];
+}
+
+inline Digest256 Sha256(const char* p, size_t n) {
+    uint32_t state[8];
+    std::memcpy(state, Sha256Const::H0, sizeof state);
+
+    auto load = [](const uint8_t* b, uint32_t block[16]) {
+        for (int i = 0; i < 16; i++)
+            block[i] = uint32_t(b[4 * i]) << 24 | b[4 * i + 1] << 16 | b[4 * i + 2] << 8 | b[4 * i + 3];
+    };
+
+    uint32_t block[16];
+    uint64_t bits = uint64_t(n) * 8;
+    for (; n >= 64; p += 64, n -= 64) {
+        load((const uint8_t*)p, block);
+        Sha256Block(state, block);
+    }
+
+    // Sisa + padding: 1 blok, atau 2 kalau sisa > 55 byte
+    uint8_t tail[128] = {};
+    std::memcpy(tail, p, n);
+    tail[n] = 0x80;
+    size_t size = n + 9 > 64 ? 128 : 64;
+    for (int i = 0; i < 8; i++)
+        tail[size - 1 - i] = bits >> (8 * i);
+    for (size_t off = 0; off < size; off += 64) {
+        load(tail + off, block);
+        Sha256Block(state, block);
+    }
+
+    Digest256 out;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 4; j++)
+            out[4 * i + j] = state[i] >> (24 - 8 * j);
+    }
+    return out;
+}
+
+#if defined(HAS_X86_SIMD)
+// SHA-256 multi-buffer: 8 pesan independen, 1 per lane 32-bit ymm.
+// w[t] = word ke-t dari blok ke-8 pesan (sudah transpose), state dari H0.
+// Output state[i] = word ke-i digest tiap lane (sebelum byte-swap ke Digest256)
+namespace Detail {
+    template <int N>
+    TARGET_AVX2 inline __m256i Rotr(__m256i x) {
+        return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+    }
+}
+
+TARGET_AVX2 inline void Sha256x8(const __m256i block[16], __m256i state[8]) {
+    using namespace Sha256Const;
+    using Detail::Rotr;
+
+    __m256i w[16];
+    for (int t = 0; t < 16; t++)
+        w[t] = block[t];
+
+    __m256i a = _mm256_set1_epi32(H0[0]), b = _mm256_set1_epi32(H0[1]);
+    __m256i c = _mm256_set1_epi32(H0[2]), d = _mm256_set1_epi32(H0[3]);
+    __m256i e = _mm256_set1_epi32(H0[4]), f = _mm256_set1_epi32(H0[5]);
+    __m256i g = _mm256_set1_epi32(H0[6]), h = _mm256_set1_epi32(H0[7]);
+
+    for (int t = 0; t < 64; t++) {
+        // Message schedule di ring 16 word, dihitung saat dipakai
+        __m256i wt = w[t & 15];
+        if (t >= 16) {
+            __m256i w15 = w[(t - 15) & 15], w2 = w[(t - 2) & 15];
+            __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(Rotr<7>(w15), Rotr<18>(w15)), _mm256_srli_epi32(w15, 3));
+            __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(Rotr<17>(w2), Rotr<19>(w2)), _mm256_srli_epi32(w2, 10));
+            wt = _mm256_add_epi32(_mm256_add_epi32(wt, s0), _mm256_add_epi32(w[(t - 7) & 15], s1));
+            w[t & 15] = wt;
+        }
+
+        __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(Rotr<6>(e), Rotr<11>(e)), Rotr<25>(e));
+        __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, _mm256_add_epi32(_mm256_set1_epi32(K[t]), wt)));
+        __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(Rotr<2>(a), Rotr<13>(a)), Rotr<22>(a));
+        __m256i mj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        __m256i t2 = _mm256_add_epi32(S0, mj);
+
+        h = g; g = f; f = e; e = _mm256_add_epi32(d, t1);
+        d = c; c = b; b = a; a = _mm256_add_epi32(t1, t2);
+    }
+
+    state[0] = _mm256_add_epi32(a, _mm256_set1_epi32(H0[0]));
+    state[1] = _mm256_add_epi32(b, _mm256_set1_epi32(H0[1]));
+    state[2] = _mm256_add_epi32(c, _mm256_set1_epi32(H0[2]));
+    state[3] = _mm256_add_epi32(d, _mm256_set1_epi32(H0[3]));
+    state[4] = _mm256_add_epi32(e, _mm256_set1_epi32(H0[4]));
+    state[5] = _mm256_add_epi32(f, _mm256_set1_epi32(H0[5]));
+    state[6] = _mm256_add_epi32(g, _mm256_set1_epi32(H0[6]));
+    state[7] = _mm256_add_epi32(h, _mm256_set1_epi32(H0[7]));
+}
+
+// FNV-1a 64 satu langkah untuk 4 lane: (h ^ c) * FNV_PRIME.
+// AVX2 tidak punya mullo 64-bit: prime = 2^40 + 0x1b3, jadi
+// h * prime = (h << 40) + lo(h) * 0x1b3 + (hi(h) * 0x1b3 << 32)
+TARGET_AVX2 inline __m256i Fnv1aStepx4(__m256i h, __m256i c) {
+    const __m256i p = _mm256_set1_epi64x(0x1b3);
+    h = _mm256_xor_si256(h, c);
+    __m256i lo = _mm256_mul_epu32(h, p);
+    __m256i hi = _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(h, 32), p), 32);
+    return _mm256_add_epi64(_mm256_add_epi64(lo, hi), _mm256_slli_epi64(h, 40));
+}
+#endif
+
+// Hex digest → byte. nullopt kalau panjang / char tidak valid
+template <size_t N>
+std::optional<std::array<uint8_t, N>> ParseHex(const str& hex) {
+    if (hex.size() != N * 2)
+        return std::nullopt;
+
+    auto nib = [](char c) -> int {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    };
+
+    std::array<uint8_t, N> out;
+    for (size_t i = 0; i < N; i++) {
+        int h = nib(hex[2 * i]), l = nib(hex[2 * i + 1]);
+        if (h < 0 || l < 0)
+            return std::nullopt;
+        out[i] = h << 4 | l;
+    }
+    return out;
+}